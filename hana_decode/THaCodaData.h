@@ -37,6 +37,10 @@ public:
    virtual int *getEvBuffer() { return evbuffer; }
    virtual int getBuffSize() const { return MAXEVLEN; }
    virtual bool isOpen() const = 0;
+   // Random access, if supported (disk files). Positions are in
+   // longwords from the start of the data.
+   virtual int codaTell(Long64_t& pos) const { pos = -1; return CODA_ERROR; }
+   virtual int codaSeek(Long64_t pos) { return CODA_ERROR; }
 
 private:
 
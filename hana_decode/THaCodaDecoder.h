@@ -21,6 +21,7 @@ class THaCodaDecoder : public THaEvData {
   ~THaCodaDecoder();
   // Loads CODA data evbuffer using THaCrateMap passed as 2nd arg
   virtual Int_t LoadEvent(const Int_t* evbuffer, THaCrateMap* usermap);    
+  virtual Int_t Init();
 
   virtual Int_t GetPrescaleFactor(Int_t trigger) const;
   virtual Int_t GetScaler(const TString& spec, Int_t slot, Int_t chan) const;
@@ -33,6 +34,7 @@ class THaCodaDecoder : public THaEvData {
 
   virtual void PrintOut() const { dump(buffer); }
   virtual void SetRunTime(ULong64_t tloc);
+  virtual void SetPrescaleFactor(Int_t trigger, Int_t ps);
 
  protected:
   THaFastBusWord* fb;
@@ -52,6 +54,8 @@ class THaCodaDecoder : public THaEvData {
 
   static void dump(const Int_t* evbuffer);
 
+  virtual THaSlotData::EDevType SlotDevType(Int_t crate, Int_t slot) const;
+
   Int_t   gendecode(const Int_t* evbuffer, THaCrateMap* map);
 
   Int_t   loadFlag(const Int_t* evbuffer);
@@ -39,6 +39,8 @@ public:
   void addEvListFilt(int event_to_filt);     // add an event num to list
   void setMaxEvFilt(int max_event);          // max num events to filter
   virtual bool isOpen() const;
+  virtual int codaTell(Long64_t& pos) const;
+  virtual int codaSeek(Long64_t pos);
 
 private:
 
@@ -0,0 +1,52 @@
+#ifndef THaCodaIndex_h
+#define THaCodaIndex_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaCodaIndex
+//  Index of the events in a CODA file
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "TString.h"
+#include <vector>
+
+class THaCodaData;
+
+class THaCodaIndex {
+
+public:
+
+  struct Entry_t {
+    Long64_t pos;    // Position of event in file (longwords)
+    UInt_t   evnum;  // Event number (physics events), see Add()
+    Int_t    type;   // Event type
+  };
+
+  THaCodaIndex();
+  virtual ~THaCodaIndex();
+
+  void     Add(Long64_t pos, const int* evbuffer);
+  int      Build(THaCodaData* coda);
+  void     Clear();
+  int      Find(UInt_t evnum) const;
+  int      FindPos(Long64_t pos) const;
+  UInt_t   GetSize() const { return fEntries.size(); }
+  Bool_t   IsPhysics(UInt_t i) const;
+  int      Read(const char* datafile);
+  int      Write(const char* datafile) const;
+  const Entry_t& operator[](UInt_t i) const { return fEntries[i]; }
+
+  static TString GetIndexFileName(const char* datafile);
+
+private:
+
+  std::vector<Entry_t> fEntries;  //! Events in file order
+  UInt_t               fLastEv;   // Last physics event number added
+
+  ClassDef(THaCodaIndex,0)   //  Index of the events in a CODA file
+
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef THaCodaMmapFile_h
+#define THaCodaMmapFile_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaCodaMmapFile
+//  Memory-mapped CODA data file (read-only)
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "THaCodaData.h"
+#include <cstddef>
+
+class THaCodaMmapFile : public THaCodaData {
+
+public:
+
+  THaCodaMmapFile();
+  THaCodaMmapFile(const char* filename);
+  virtual ~THaCodaMmapFile();
+  virtual int codaOpen(const char* filename, int mode=1);
+  virtual int codaOpen(const char* filename, const char* rw, int mode=1);
+  virtual int codaClose();
+  virtual int codaRead();
+  virtual int *getEvBuffer() { return fEvent; }
+  virtual bool isOpen() const { return (fMap != 0); }
+  virtual int codaTell(Long64_t& pos) const;
+  virtual int codaSeek(Long64_t pos);
+
+private:
+
+  THaCodaMmapFile(const THaCodaMmapFile &fn);
+  THaCodaMmapFile& operator=(const THaCodaMmapFile &fn);
+
+  int   header(int i) const;
+  int   nextBlock();
+
+  char*  fMap;      // Start of file mapping
+  size_t fMapSize;  // Size of mapping (bytes)
+  int*   fBlock;    // Start of current block
+  int*   fNext;     // Next unread word in current block
+  int    fLeft;     // Number of unread words in current block
+  int    fBlkSiz;   // Block size (words)
+  int    fBlkNum;   // Current block number
+  bool   fSwapped;  // File is byte-swapped
+  int*   fEvent;    // Current event (in mapping or in evbuffer)
+  int*   fSwapBuf;  // Scratch buffer for byte-swapped events
+
+  ClassDef(THaCodaMmapFile,0)   //  Memory-mapped file of CODA data
+
+};
+
+#endif
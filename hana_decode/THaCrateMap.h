@@ -40,6 +40,7 @@ class THaCrateMap
      int getHeader(int crate, int slot) const;      // Return header
      int getMask(int crate, int slot) const;        // Return header mask
      int getScalerCrate(int word) const;            // Return scaler crate if word=header
+     int findSlot(int crate, int word) const;       // Slot not done whose header matches word
      const char* getScalerLoc(int crate) const;     // Return scaler crate location 
      int setCrateType(int crate, const char* type); // set the crate type
      int setModel(int crate, int slot, UShort_t mod,
@@ -62,6 +63,8 @@ class THaCrateMap
      int init_hc(ULong64_t time);                   // Hard-coded crate-map
      void print() const;
 
+     static void ClearCache();                      // Drop cached maps
+
      static const int CM_OK;
      static const int CM_ERR;
 
@@ -90,6 +93,14 @@ class THaCrateMap
      UShort_t nchan[MAXROC][MAXSLOT]; // Number of channels for device
      UShort_t ndata[MAXROC][MAXSLOT]; // Number of datawords
      TString scalerloc[MAXROC];
+     // Lookup table of headers for findSlot(). For each distinct header
+     // mask in a crate, the masked header is hashed into headslot.
+     enum { HEADHASH = 64 };                 // Hash table size, power of 2
+     int nheadmask[MAXROC];                  // Number of distinct masks
+     int headmasks[MAXROC][MAXSLOT];         // Distinct masks
+     signed char headslot[MAXROC][HEADHASH]; // First slot for header, or -1
+     signed char nextslot[MAXROC][MAXSLOT];  // Next slot with same header
+     void makeHeadIndex(int crate);
      void incrNslot(int crate);
      void setUsed(int crate,int slot);
      void setClear(int crate,int slot,bool clear);
@@ -200,6 +211,35 @@ int THaCrateMap::getHeader(int crate, int slot) const
   return header[crate][slot];
 }
 
+inline
+int THaCrateMap::findSlot(int crate, int word) const
+{
+  // Find the slot in 'crate' whose header signature matches 'word' and that
+  // is not yet done (see setSlotDone). If several slots match, the lowest
+  // numbered one is returned. Returns -1 if there is none.
+  // Takes constant time, independent of the number of slots.
+  assert( crate >= 0 && crate < MAXROC );
+  int found = -1;
+  for( int i=0; i<nheadmask[crate]; i++ ) {
+    int mask = headmasks[crate][i];
+    int head = word & mask;
+    unsigned int h = (static_cast<unsigned int>(head)*2654435761U) >> 26;
+    int slot;
+    while( (slot = headslot[crate][h]) >= 0 ) {
+      if( headmask[crate][slot] == mask && header[crate][slot] == head ) {
+	// Slots with the same header are chained in increasing order
+	while( slot >= 0 && didslot[slot] )
+	  slot = nextslot[crate][slot];
+	if( slot >= 0 && (found < 0 || slot < found) )
+	  found = slot;
+	break;
+      }
+      h = (h+1) & (HEADHASH-1);
+    }
+  }
+  return found;
+}
+
 inline
 void THaCrateMap::setUsed(int crate, int slot)
 {
@@ -34,6 +34,11 @@ public:
   //FIXME: the crate map should become part of the database
   virtual Int_t LoadEvent(const Int_t* evbuffer, THaCrateMap* usermap) = 0;    
 
+  // Initialize crate map etc. for the current run time. Done automatically
+  // by LoadEvent() when needed, but may be called explicitly.
+  virtual Int_t Init();
+  Bool_t    IsInit() const;
+
   // Basic access to the decoded data
   Int_t     GetEvType()   const { return event_type; }
   Int_t     GetEvLength() const { return event_length; }
@@ -50,6 +55,8 @@ public:
   Bool_t    IsEpicsEvent() const;      // epics data inserted in datastream
   Bool_t    IsPrescaleEvent() const;   // prescale factors
   Bool_t    IsSpecialEvent() const;    // e.g. detmap or trigger file insertion
+  // Test raw CODA event buffer for physics trigger without decoding it
+  static Bool_t IsPhysicsBuffer(const Int_t* evbuffer);
   // number of raw words in crate, slot
   Int_t     GetNumRaw(Int_t crate, Int_t slot) const;
   // raw words for hit 0,1,2.. on crate, slot
@@ -58,16 +65,26 @@ public:
   Int_t     GetRawData(Int_t crate, Int_t slot, Int_t chan, Int_t hit) const;
   // To get element #i of the raw evbuffer
   Int_t     GetRawData(Int_t i) const;
+  // The raw evbuffer of the current event
+  const Int_t* GetRawDataBuffer() const { return buffer; }
   // Get raw element i within crate
   Int_t     GetRawData(Int_t crate, Int_t i) const;
   Int_t     GetNumHits(Int_t crate, Int_t slot, Int_t chan) const;
   Int_t     GetData(Int_t crate, Int_t slot, Int_t chan, Int_t hit) const;
+  // All hits of crate, slot, channel as one contiguous array. Sets 'nhits'
+  // to its length. Faster than GetData() for each hit.
+  const Int_t* GetDataSpan(Int_t crate, Int_t slot, Int_t chan,
+			   Int_t& nhits) const;
+  const Int_t* GetRawDataSpan(Int_t crate, Int_t slot, Int_t chan,
+			      Int_t& nhits) const;
   Bool_t    InCrate(Int_t crate, Int_t i) const;
   // Num unique channels hit
   Int_t     GetNumChan(Int_t crate, Int_t slot) const;
   // List unique chan
   Int_t     GetNextChan(Int_t crate, Int_t slot, Int_t index) const;
   const char* DevType(Int_t crate, Int_t slot) const;
+  // Module-specific data (e.g. flash ADC samples), or 0 if none
+  const THaModuleData* GetModuleData(Int_t crate, Int_t slot) const;
 
   // Optional functionality that may be implemented by derived classes
   virtual ULong64_t GetEvTime() const { return evt_time; }
@@ -97,6 +114,8 @@ public:
   virtual void PrintSlotData(Int_t crate, Int_t slot) const;
   virtual void PrintOut() const;
   virtual void SetRunTime( ULong64_t tloc );
+  virtual void SetPrescaleFactor( Int_t /*trigger*/, Int_t /*ps*/ )
+  { assert(fgAllowUnimpl); }
 
   // Status control
   void    EnableBenchmarks( Bool_t enable=true );
@@ -110,6 +129,9 @@ public:
   UInt_t  GetInstance() const { return fInstance; }
   static UInt_t GetInstances() { return fgInstances.CountBits(); }
 
+  // Copy event type/number/length/time from another decoder
+  void    CopyEventHeader( const THaEvData& rhs );
+
   // Reporting level
   void SetVerbose( UInt_t level );
   void SetDebug( UInt_t level );
@@ -177,6 +199,8 @@ protected:
   Int_t init_cmap();
   Int_t init_slotdata(const THaCrateMap* map);
   void  makeidx(Int_t crate, Int_t slot);
+  virtual THaSlotData::EDevType SlotDevType(Int_t /*crate*/, Int_t /*slot*/) const
+  { return THaSlotData::kUnknownDev; }
 
   Int_t     fNSlotUsed;   // Number of elements of crateslot[] actually used
   Int_t     fNSlotClear;  // Number of elements of crateslot[] to clear
@@ -188,6 +212,9 @@ protected:
   Bool_t fDoBench;
   THaBenchmark *fBench;
 
+  Bool_t fNeedInit;            // Crate map needs to be (re-)initialized
+  UInt_t fCrateMapID;          // Value of fgCrateMapID at last init_cmap()
+
   UInt_t fInstance;            // My instance
   static TBits fgInstances;    // Number of instances of this object
 
@@ -196,7 +223,7 @@ protected:
 
   static const TString fgDefaultCrateMapName; // Default crate map name
   static TString fgCrateMapName; // Crate map database file name to use
-  static Bool_t fgNeedInit;  // Crate map needs to be (re-)initialized
+  static UInt_t fgCrateMapID;    // Incremented when fgCrateMapName changes
 
   ClassDef(THaEvData,0)  // Decoder for CODA event buffer
 
@@ -215,6 +242,11 @@ inline Int_t THaEvData::idx( Int_t crate, Int_t slot) {
   return idx;
 }
 
+inline Bool_t THaEvData::IsInit() const {
+  // True if the crate map is loaded and up to date
+  return ( !first_decode && !fNeedInit && fCrateMapID == fgCrateMapID );
+}
+
 inline Bool_t THaEvData::GoodCrateSlot( Int_t crate, Int_t slot ) const {
   return ( crate >= 0 && crate < MAXROC && 
 	   slot >= 0 && slot < MAXSLOT );
@@ -237,6 +269,39 @@ inline Int_t THaEvData::GetNumHits(Int_t crate, Int_t slot, Int_t chan) const {
   return 0;
 };
 
+inline const Int_t* THaEvData::GetDataSpan(Int_t crate, Int_t slot,
+					   Int_t chan, Int_t& nhits) const {
+  // Data of all hits in crate, slot, channel. Returns 0 if no hits.
+  assert( GoodCrateSlot(crate,slot) );
+  const THaSlotData* sd = crateslot[idx(crate,slot)];
+  if( !sd || (nhits = sd->getNumHits(chan)) == 0 ) {
+    nhits = 0;
+    return 0;
+  }
+  return sd->getDataSpan(chan);
+};
+
+inline const Int_t* THaEvData::GetRawDataSpan(Int_t crate, Int_t slot,
+					      Int_t chan, Int_t& nhits) const {
+  // Raw data words of all hits in crate, slot, channel. Returns 0 if no hits.
+  assert( GoodCrateSlot(crate,slot) );
+  const THaSlotData* sd = crateslot[idx(crate,slot)];
+  if( !sd || (nhits = sd->getNumHits(chan)) == 0 ) {
+    nhits = 0;
+    return 0;
+  }
+  return sd->getRawDataSpan(chan);
+};
+
+inline const THaModuleData* THaEvData::GetModuleData(Int_t crate,
+						     Int_t slot) const {
+  // Module-specific data of crate, slot, if any
+  assert( GoodCrateSlot(crate,slot) );
+  if( crateslot[idx(crate,slot)] != 0 )
+    return crateslot[idx(crate,slot)]->getModuleData();
+  return 0;
+};
+
 inline Int_t THaEvData::GetData(Int_t crate, Int_t slot, Int_t chan,
 				Int_t hit) const {
   // Return the data in crate, slot, channel #chan and hit# hit
@@ -309,6 +374,13 @@ Bool_t THaEvData::IsPhysicsTrigger() const {
   return ((event_type > 0) && (event_type <= MAX_PHYS_EVTYPE));
 };
 
+inline
+Bool_t THaEvData::IsPhysicsBuffer(const Int_t* evbuffer) {
+  assert(evbuffer);
+  Int_t type = evbuffer[1]>>16;
+  return ((type > 0) && (type <= MAX_PHYS_EVTYPE));
+};
+
 inline
 Bool_t THaEvData::IsScalerEvent() const {
   // Either 'event type 140' or events with the synchronous readout
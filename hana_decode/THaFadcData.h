@@ -0,0 +1,156 @@
+#ifndef THaFadcData_h
+#define THaFadcData_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaFadcData
+//  Data of one JLab 250 MHz flash ADC (FADC250) module
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "THaSlotData.h"
+#include <vector>
+
+class THaFadcData : public THaModuleData {
+
+public:
+
+  enum { NCHAN = 16, MAXPULSE = 4 };
+
+  // Parameters of the software pulse analysis, see AnalyzeSamples()
+  struct PulseParam_t {
+    Int_t nped;       // Number of samples at start of window for pedestal
+    Int_t threshold;  // Pulse threshold above pedestal (ADC counts)
+    Int_t nsb;        // Number of samples to integrate before crossing
+    Int_t nsa;        // Number of samples to integrate after crossing
+  };
+  // Results of the software pulse analysis
+  struct PulseResult_t {
+    Double_t pedestal;  // Average of the pedestal samples
+    Double_t integral;  // Pedestal-subtracted pulse integral
+    Double_t time;      // Leading-edge time (samples), or -1 if no pulse
+    Int_t    peak;      // Maximum sample value
+    Int_t    peakpos;   // Sample number of maximum
+    Int_t    cross;     // First sample above threshold, or -1 if no pulse
+  };
+
+  THaFadcData();
+  virtual ~THaFadcData();
+
+  virtual void Clear();
+
+  // Samples from "window raw data"
+  Int_t  GetNsamples( Int_t chan ) const;
+  const UShort_t* GetSamples( Int_t chan ) const;
+  // Samples from "pulse raw data", separately for each pulse
+  Int_t  GetNpulseSamples( Int_t chan, Int_t ipulse ) const;
+  const UShort_t* GetPulseSamples( Int_t chan, Int_t ipulse ) const;
+  Int_t  GetPulseFirstSample( Int_t chan, Int_t ipulse ) const;
+  // Results from firmware pulse analysis
+  Bool_t HasWindowSum( Int_t chan ) const;
+  Int_t  GetWindowSum( Int_t chan ) const;
+  Bool_t IsWindowSumOverflow( Int_t chan ) const;
+  Int_t  GetNpulses( Int_t chan ) const;
+  Int_t  GetPulseIntegral( Int_t chan, Int_t ipulse ) const;
+  Int_t  GetPulseTime( Int_t chan, Int_t ipulse ) const;
+
+  // Software pulse analysis
+  Int_t  AnalyzePulse( Int_t chan, const PulseParam_t& par,
+		       PulseResult_t& res, Int_t ipulse = -1 ) const;
+  static Int_t AnalyzeSamples( const UShort_t* samples, Int_t nsamples,
+			       const PulseParam_t& par, PulseResult_t& res );
+
+  // Filled by the decoder
+  void   AddSample( Int_t chan, UShort_t sample );
+  void   AddPulseSample( Int_t chan, Int_t ipulse, UShort_t sample );
+  void   SetPulseFirstSample( Int_t chan, Int_t ipulse, Int_t first );
+  void   SetWindowSum( Int_t chan, Int_t sum, Bool_t overflow );
+  void   SetPulseIntegral( Int_t chan, Int_t ipulse, Int_t integral );
+  void   SetPulseTime( Int_t chan, Int_t ipulse, Int_t time );
+
+  static const Double_t kNsPerSample;  // Sampling period (ns)
+
+private:
+
+  UInt_t    fChanUsed;          // Bit pattern of channels with data
+  std::vector<UShort_t> fSamples[NCHAN];  //! Window samples per channel
+  std::vector<UShort_t> fPulseSamples[NCHAN][MAXPULSE]; //! Pulse samples
+  Int_t     fPulseFirst[NCHAN][MAXPULSE]; // Sample number of first sample
+  Int_t     fWinSum[NCHAN];     // Window sum (-1 if none)
+  Bool_t    fWinOvf[NCHAN];     // Window sum overflow
+  Int_t     fNpulse[NCHAN];     // Number of pulses reported
+  Int_t     fIntegral[NCHAN][MAXPULSE]; // Pulse integrals (-1 if none)
+  Int_t     fTime[NCHAN][MAXPULSE];     // Pulse times (-1 if none)
+
+  void      ClearChan( Int_t chan );
+  void      UseChan( Int_t chan );
+  void      UsePulse( Int_t chan, Int_t ipulse );
+
+  ClassDef(THaFadcData,0)   //  Data of a JLab FADC250 module
+};
+
+//_____________________________________________________________________________
+inline
+Int_t THaFadcData::GetNsamples( Int_t chan ) const
+{
+  return (chan >= 0 && chan < NCHAN) ?
+    static_cast<Int_t>(fSamples[chan].size()) : 0;
+}
+
+//_____________________________________________________________________________
+inline
+const UShort_t* THaFadcData::GetSamples( Int_t chan ) const
+{
+  // Pointer to the GetNsamples(chan) samples of 'chan', or 0 if none
+  if( chan < 0 || chan >= NCHAN || fSamples[chan].empty() )
+    return 0;
+  return &fSamples[chan][0];
+}
+
+//_____________________________________________________________________________
+inline
+Int_t THaFadcData::GetNpulseSamples( Int_t chan, Int_t ipulse ) const
+{
+  if( chan < 0 || chan >= NCHAN || ipulse < 0 || ipulse >= MAXPULSE )
+    return 0;
+  return static_cast<Int_t>(fPulseSamples[chan][ipulse].size());
+}
+
+//_____________________________________________________________________________
+inline
+const UShort_t* THaFadcData::GetPulseSamples( Int_t chan, Int_t ipulse ) const
+{
+  // Pointer to the GetNpulseSamples(chan,ipulse) samples of pulse 'ipulse'
+  // of 'chan', or 0 if none
+  if( GetNpulseSamples(chan,ipulse) == 0 )
+    return 0;
+  return &fPulseSamples[chan][ipulse][0];
+}
+
+//_____________________________________________________________________________
+inline
+void THaFadcData::UseChan( Int_t chan )
+{
+  fChanUsed |= (1U<<chan);
+}
+
+//_____________________________________________________________________________
+inline
+void THaFadcData::AddSample( Int_t chan, UShort_t sample )
+{
+  assert( chan >= 0 && chan < NCHAN );
+  UseChan(chan);
+  fSamples[chan].push_back(sample);
+}
+
+//_____________________________________________________________________________
+inline
+void THaFadcData::AddPulseSample( Int_t chan, Int_t ipulse, UShort_t sample )
+{
+  assert( chan >= 0 && chan < NCHAN && ipulse >= 0 && ipulse < MAXPULSE );
+  UsePulse(chan,ipulse);
+  fPulseSamples[chan][ipulse].push_back(sample);
+}
+
+#endif
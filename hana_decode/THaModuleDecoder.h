@@ -0,0 +1,56 @@
+#ifndef THaModuleDecoder_h
+#define THaModuleDecoder_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaModuleDecoder
+//  Base class and registry of decoders for DAQ modules
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "THaSlotData.h"
+
+class THaModuleDecoder {
+
+public:
+
+  // The module being decoded
+  struct Module_t {
+    Int_t        crate;    // Crate (ROC) number
+    Int_t        slot;     // Slot number
+    Int_t        model;    // Model number from crate map
+    Int_t        header;   // Header signature from crate map
+    Int_t        mask;     // Header mask from crate map
+    Int_t        evnum;    // Current event number (for messages)
+    Bool_t       verbose;  // Print warnings
+    Bool_t       debug;    // Print debug messages
+    THaSlotData* data;     // Storage for the decoded data
+  };
+
+  THaModuleDecoder() {}
+  virtual ~THaModuleDecoder() {}
+
+  // Decode the data of one module. On entry, p points to the module's
+  // header word. On return, p must point to the last word belonging to
+  // the module. pstop points to the last data word of the crate.
+  // Returns SD_OK, or SD_WARN/SD_ERR as returned by THaSlotData::loadData.
+  virtual Int_t Decode( const Int_t*& p, const Int_t* pstop,
+			const Module_t& mod ) const = 0;
+
+  // Type of the data (adc, tdc etc.) produced by this decoder
+  virtual THaSlotData::EDevType GetDevType() const = 0;
+
+  static THaModuleDecoder* Find( Int_t model );
+  static Int_t   Register( Int_t model, THaModuleDecoder* decoder );
+  static void    PrintRegistry();
+
+private:
+
+  THaModuleDecoder( const THaModuleDecoder& );
+  THaModuleDecoder& operator=( const THaModuleDecoder& );
+
+  ClassDef(THaModuleDecoder,0)   //  Decoder for one type of DAQ module
+};
+
+#endif
@@ -26,6 +26,15 @@ const int SD_WARN = -2;
 const int SD_ERR = -1; 
 const int SD_OK = 1;
 
+// Base class for module-specific data that do not fit the channel/hit
+// scheme of THaSlotData, e.g. the samples and pulse data of a flash ADC.
+// Created by the module's decoder and owned by the slot.
+class THaModuleData {
+public:
+       virtual ~THaModuleData() {}
+       virtual void Clear() = 0;   // Called by THaSlotData::clearEvent()
+};
+
 class THaSlotData {
 
 public:
@@ -34,10 +43,17 @@ public:
        static const int DEFNDATA; // Default number of data words
        static const int DEFNHITCHAN; // Default number of hits per channel
 
+       // Device types. The type of a slot is set once, usually from the
+       // module model in the crate map, see setDevType().
+       enum EDevType { kUnknownDev = 0, kAdc, kTdc, kScaler, kRegister };
+
        THaSlotData();
        THaSlotData(int crate, int slot);
        virtual ~THaSlotData();
        const char* devType() const;             // "adc", "tdc", "scaler"
+       EDevType getDevType() const { return devtype; }
+       void setDevType(EDevType type, const char* name = 0);
+       static EDevType DevType(const char* name);  // "adc" -> kAdc etc.
        int getNumRaw() const { return numraw; };  // Amount of raw CODA data
        int getRawData(int ihit) const;            // Returns raw data words
        int getRawData(int chan, int hit) const;
@@ -45,39 +61,47 @@ public:
        int getNumChan() const;              // Num unique channels hit
        int getNextChan(int index) const;    // List of unique channels hit
        int getData(int chan, int hit) const;  // Data (adc,tdc,scaler) on 1 chan
+       // All hits of one channel, contiguous (getNumHits(chan) elements)
+       const int* getDataSpan(int chan) const;
+       const int* getRawDataSpan(int chan) const;
+       THaModuleData* getModuleData() const { return moddata; }
+       void setModuleData(THaModuleData* mdata);  // Takes ownership
        int getCrate() const { return crate; }
        int getSlot()  const { return slot; }
        void clearEvent();                   // clear event counters
+       int loadData(int chan, int dat, int raw);
        int loadData(const char* type, int chan, int dat, int raw);
        void define(int crate, int slot, UShort_t nchan=DEFNCHAN, 
 		   UShort_t ndata=DEFNDATA, UShort_t nhitperchan=DEFNHITCHAN );// Define crate, slot
        void print() const;
-       int compressdataindex(int numidx); 
 
 private:
 
+       int loadError(int chan) const;
+       void sortHits() const;
+       void deleteArrays();
  
        int crate;
        int slot;
-       TString device;
-       UShort_t numhitperchan; // expected number of hits per channel
+       TString device;       // Name of device type (set once per slot)
+       EDevType devtype;     // Device type
        UShort_t numraw;      // Hit counters (numraw, numHits, numchanhit)
        UShort_t numchanhit;  // can be zero'd by clearEvent each event.
-       UShort_t firstfreedataidx;     // pointer to first free space in dataindex array 
-       UShort_t numholesdataidx;
-       UChar_t* numHits;     // numHits[channel]
-       UShort_t* chanlist;   // chanlist[hitindex]
-       UShort_t* idxlist;    // [channel] pointer to 1st entry in dataindex
-       UShort_t* chanindex;  // [channel] gives hitindex
-       UShort_t* dataindex;  // [idxlist] pointer to rawdata and  data
-       UChar_t* numMaxHits;  // [channel] current maximum number of hits
-       int* rawData;         // rawData[hit] (all bits)
-       int* data;            // data[hit] (only data bits)
+       UShort_t* numHits;    // [maxc] Number of hits per channel
+       UShort_t* chanlist;   // [maxc] Channels hit, in order of first hit
+       UShort_t* hitchan;    // [maxd] Channel of each hit, in order loaded
+       int* rawData;         // [maxd] rawData[hit] (all bits), in order loaded
+       int* data;            // [maxd] data[hit] (only data bits), in order loaded
+       // Hits sorted by channel, so that the hits of each channel are
+       // contiguous. Built on demand from the above, see sortHits().
+       mutable bool sorted;       // Sorted arrays are up to date
+       mutable UShort_t* chanpos; // [maxc] Index of channel's first hit
+       mutable int* sortRaw;      // [maxd] rawData sorted by channel
+       mutable int* sortData;     // [maxd] data sorted by channel
        bool didini;          // true if object initialized via define()
        UShort_t maxc;        // Number of channels for this device
        UShort_t maxd;        // Max number of data words per event
-       UShort_t allocd;      // Allocated size of data arrays
-       UShort_t alloci;      // Allocated size of dataindex array
+       THaModuleData* moddata; // Module-specific data, if any
 
        ClassDef(THaSlotData,0)   //  Data in one slot of fastbus, vme, camac
 };
@@ -97,10 +121,8 @@ int THaSlotData::getRawData(int chan, int hit) const {
   assert( chan >= 0 && chan < maxc && hit >= 0 &&  hit < numHits[chan] );
   if (chan < 0 || chan >= maxc || numHits[chan]<=hit || hit<0 )
     return 0;
-  int index = dataindex[idxlist[chan]+hit];
-  assert(index >= 0 && index < numraw);
-  if (index >= 0 && index < numraw) return rawData[index];
-  return 0; 
+  if( !sorted ) sortHits();
+  return sortRaw[chanpos[chan]+hit];
 };
 
 //_____________________________________________________________________________
@@ -135,10 +157,30 @@ int THaSlotData::getData(int chan, int hit) const {
   assert( chan >= 0 && chan < maxc && hit >= 0 &&  hit < numHits[chan] );
   if (chan < 0 || chan >= maxc || numHits[chan]<=hit || hit<0 )
     return 0;
-  int index = dataindex[idxlist[chan]+hit];
-  assert(index >= 0 && index < numraw);
-  if (index >= 0 && index < numraw) return data[index];
-  return 0; 
+  if( !sorted ) sortHits();
+  return sortData[chanpos[chan]+hit];
+};
+
+//_____________________________________________________________________________
+inline
+const int* THaSlotData::getDataSpan(int chan) const {
+  // Pointer to the data of all getNumHits(chan) hits of channel 'chan',
+  // in the order they were loaded. Zero if the channel has no hits.
+  // Valid until the next clearEvent()/loadData().
+  if (chan < 0 || chan >= maxc || numHits[chan] == 0)
+    return 0;
+  if( !sorted ) sortHits();
+  return sortData+chanpos[chan];
+};
+
+//_____________________________________________________________________________
+inline
+const int* THaSlotData::getRawDataSpan(int chan) const {
+  // Same as getDataSpan() for the raw data words
+  if (chan < 0 || chan >= maxc || numHits[chan] == 0)
+    return 0;
+  if( !sorted ) sortHits();
+  return sortRaw+chanpos[chan];
 };
 
 //_____________________________________________________________________________
@@ -148,46 +190,46 @@ const char* THaSlotData::devType() const {
   return device.Data();
 };
 
+//_____________________________________________________________________________
+inline
+int THaSlotData::loadData(int chan, int dat, int raw) {
+  // loadData loads the data into storage arrays.
+  // CAUTION: this code is critical for performance. The device type
+  // is not looked at here; it is set once per slot via setDevType().
+
+  // A slot that was never defined has maxc == 0, so this single test
+  // also catches that case (reported by loadError)
+  if( static_cast<unsigned int>(chan) >= maxc || numraw >= maxd )
+    return loadError(chan);
+  if( numHits[chan]++ == 0 )
+    chanlist[numchanhit++] = chan;
+  hitchan[numraw] = chan;
+  rawData[numraw] = raw;
+  data[numraw++]  = dat;
+  sorted = false;
+  return SD_OK;
+};
+
+//_____________________________________________________________________________
+inline
+int THaSlotData::loadData(const char* type, int chan, int dat, int raw) {
+  // Load data, setting the device type from the name 'type' if the type of
+  // this slot is not yet known. Prefer loadData(chan,dat,raw) in decoding
+  // loops, with the device type set beforehand via setDevType().
+  if( devtype == kUnknownDev && type && device.IsNull() )
+    setDevType( DevType(type), type );
+  return loadData(chan,dat,raw);
+};
+
 //_____________________________________________________________________________
 inline
 void THaSlotData::clearEvent() {
   // Only the minimum is cleared; e.g. data array is not cleared.
   // CAUTION: this code is critical for performance
   numraw = 0;
-  firstfreedataidx=0;
-  numholesdataidx=0;
+  sorted = true;
   while( numchanhit>0 ) numHits[chanlist[--numchanhit]] = 0;
+  if( moddata ) moddata->Clear();
 };
 
-//_____________________________________________________________________________
-inline  
-int THaSlotData::compressdataindex(int numidx) {
-
-  // first check if it is more favourable to expand it, or to reshuffle
-  if (firstfreedataidx+numidx>=alloci){
-    if (((numholesdataidx/alloci)>0.5)&&(numholesdataidx>numidx)) {
-      // reshuffle, lots of holes
-      UShort_t* tmp = new UShort_t[alloci];
-      firstfreedataidx=0;
-      for (UShort_t i=0; i<numchanhit; i++) {
-	UShort_t chan=chanlist[i];
-	for (UShort_t j=0; j<numHits[chan]; j++) {
-	  tmp[firstfreedataidx+j]=dataindex[idxlist[chan]+j];
-	}
-	firstfreedataidx=firstfreedataidx+numMaxHits[chan];
-      }
-      delete [] dataindex; dataindex=tmp;
-    } else {
-      UShort_t old_alloci = alloci;
-      alloci *= 2; 
-      // FIX ME one should check that it doesnt grow too much
-      UShort_t* tmp = new UShort_t[alloci];
-      memcpy(tmp,dataindex,old_alloci*sizeof(UShort_t));
-      delete [] dataindex; dataindex = tmp;
-    }      
-  }
-  return 0;
-};
-
-
 #endif
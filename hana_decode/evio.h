@@ -21,6 +21,8 @@ typedef struct evfilestruct {
 extern int evOpen(const char* filename, const char* flags, void **handle);
 extern int evRead(void* handle, int *buffer, int buflen);
 extern int evGetNewBuffer(EVFILE *a);
+extern int evTell(void* handle, long long *pos);
+extern int evSeek(void* handle, long long pos);
 extern int evWrite(void* handle,const int *buffer);
 extern int evFlush(EVFILE *a);
 extern int evIoctl(void* handle,char *request,void *argp);
@@ -6,6 +6,8 @@
 
 #pragma link C++ class THaCodaData+;
 #pragma link C++ class THaCodaFile+;
+#pragma link C++ class THaCodaMmapFile+;
+#pragma link C++ class THaCodaIndex+;
 #pragma link C++ class THaCrateMap+;
 #pragma link C++ class THaEpics+;
 #pragma link C++ class THaEvData+;
@@ -13,6 +15,8 @@
 #pragma link C++ class THaSlotData+;
 #pragma link C++ class THaUsrstrutils+;
 #pragma link C++ class THaCodaDecoder+;
+#pragma link C++ class THaModuleDecoder+;
+#pragma link C++ class THaFadcData+;
 #pragma link C++ class THaBenchmark+;
 #pragma link C++ class THaEvData::RocDat_t+;
 
@@ -17,6 +17,7 @@
 #pragma link C++ class THaVarList+;
 #pragma link C++ class THaNamedList+;
 #pragma link C++ class THaFormula+;
+#pragma link C++ class THaExprGraph+;
 #pragma link C++ class THaVform+;
 #pragma link C++ class THaVhist+;
 #pragma link C++ class THaCut+;
@@ -52,6 +53,12 @@
 //#pragma link C++ class THaOdata+;
 //#pragma link C++ class THaScalerKey+;
 #pragma link C++ class THaAnalyzer+;
+#pragma link C++ class THaDecoderPool+;
+#pragma link C++ class THaInitScheduler+;
+#pragma link C++ class THaTreeWriter+;
+#pragma link C++ class THaOutputWriter+;
+#pragma link C++ class THaColumnWriter+;
+#pragma link C++ class THaColumnReader+;
 #pragma link C++ class THaPrintOption+;
 #pragma link C++ class THaBeam+;
 #pragma link C++ class THaBeamDet+;
@@ -68,6 +75,7 @@
 #pragma link C++ class THaCluster+;
 #pragma link C++ class THaArrayString+;
 #pragma link C++ class THaCherenkov+;
+#pragma link C++ class THaFadcDetector+;
 #pragma link C++ class THaTotalShower+;
 #pragma link C++ class THaVDC+;
 #pragma link C++ class THaVDCUVPlane+;
@@ -22,7 +22,7 @@ class TVector3;
 class THaRunBase;
 class THaOutput;
 
-const char* Here( const char* here, const char* prefix = NULL );
+TString Here( const char* here, const char* prefix = NULL );
 
 class THaAnalysisObject : public TNamed {
   
@@ -96,6 +96,9 @@ public:
 				const char* label = "config",
 				Bool_t end_on_tag = false );
   static  bool    IsTag( const char* buf );
+  static  void    ClearDBcache();
+  static  Int_t   WriteDBsnapshot( const char* filename, const TDatime& date );
+  static  Int_t   LoadDBsnapshot( const char* filename );
 
   // Generic utility functions
   static std::vector<std::string> vsplit( const std::string& s );
@@ -151,7 +154,7 @@ protected:
   THaAnalysisObject*   FindModule( const char* name, const char* classname,
 				   bool do_error = true );
 
-  virtual const char*  Here( const char* ) const;
+  virtual TString      Here( const char* ) const;
           void         MakePrefix( const char* basename );
   virtual void         MakePrefix() = 0;
   virtual FILE*        OpenFile( const TDatime& date );
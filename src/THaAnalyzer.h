@@ -14,6 +14,7 @@ class THaEvent;
 class THaRunBase;
 class THaOutput;
 class TList;
+class TCollection;
 class TIter;
 class TFile;
 class TDatime;
@@ -22,6 +23,8 @@ class THaBenchmark;
 class THaEvData;
 class THaPostProcess;
 class THaCrateMap;
+class THaDecoderPool;
+class THaInitScheduler;
 
 class THaAnalyzer : public TObject {
 
@@ -35,6 +38,7 @@ public:
           Int_t  Init( THaRunBase& run )    { return Init( &run ); }
   virtual Int_t  Process( THaRunBase* run=NULL );
           Int_t  Process( THaRunBase& run ) { return Process(&run); }
+  virtual Int_t  ProcessSegments( const TCollection* runs );
   virtual void   Print( Option_t* opt="" ) const;
 
   void           EnableBenchmarks( Bool_t b = kTRUE );
@@ -42,6 +46,7 @@ public:
   void           EnableOtherEvents( Bool_t b = kTRUE );
   void           EnableOverwrite( Bool_t b = kTRUE );
   void           EnablePhysicsEvents( Bool_t b = kTRUE );
+  void           EnablePipeline( Bool_t b = kTRUE );
   void           EnableRunUpdate( Bool_t b = kTRUE );
   void           EnableScalers( Bool_t b = kTRUE );
   void           EnableSlowControl( Bool_t b = kTRUE );
@@ -57,10 +62,13 @@ public:
   TList*         GetPhysics()          const  { return fPhysics; }
   TList*         GetScalers()          const  { return fScalers; }
   TList*         GetPostProcess()      const  { return fPostProcess; }
+  UInt_t         GetNThreads()         const  { return fNThreads; }
+  UInt_t         GetNInitThreads()     const  { return fNInitThreads; }
   Bool_t         HasStarted()          const  { return fAnalysisStarted; }
   Bool_t         HelicityEnabled()     const  { return fDoHelicity; }
   Bool_t         PhysicsEnabled()      const  { return fDoPhysics; }
   Bool_t         OtherEventsEnabled()  const  { return fDoOtherEvents; }
+  Bool_t         PipelineEnabled()     const  { return fDoPipeline; }
   Bool_t         ScalersEnabled()      const  { return fDoScalers; }
   Bool_t         SlowControlEnabled()  const  { return fDoSlowControl; }
   virtual Int_t  SetCountMode( Int_t mode );
@@ -72,6 +80,8 @@ public:
   void           SetSummaryFile( const char* name ) { fSummaryFileName = name; }
   void           SetCompressionLevel( Int_t level ) { fCompress = level; }
   void           SetMarkInterval( UInt_t interval ) { fMarkInterval = interval; }
+  void           SetNThreads( UInt_t n )            { fNThreads = n; }
+  void           SetNInitThreads( UInt_t n )        { fNInitThreads = n; }
   void           SetVerbosity( Int_t level )        { fVerbose = level; }
 
   static THaAnalyzer* GetInstance() { return fgAnalyzer; }
@@ -133,6 +143,10 @@ protected:
   TList*         fPhysics;         //List of physics modules
   TList*         fScalers;         //List of scaler groups
   TList*         fPostProcess;     //List of post-processing modules
+  UInt_t         fNThreads;        //Number of raw decoding threads (0/1=serial)
+  THaDecoderPool* fDecoderPool;    //Parallel decoders/read-ahead (if enabled)
+  UInt_t         fNInitThreads;    //Number of module init threads (0/1=serial)
+  THaInitScheduler* fInitScheduler; //Concurrent module initialization
 
   // Status and control flags
   Bool_t         fIsInit;          // Init() called successfully
@@ -141,6 +155,7 @@ protected:
   Bool_t         fUpdateRun;       // Update run parameters during replay
   Bool_t         fOverwrite;       // Overwrite existing output files
   Bool_t         fDoBench;         // Collect detailed timing statistics
+  Bool_t         fDoPipeline;      // Read and decode events ahead in threads
   Bool_t         fDoHelicity;      // Enable helicity decoding
   Bool_t         fDoPhysics;       // Enable physics event processing
   Bool_t         fDoOtherEvents;   // Enable other event processing
@@ -151,21 +166,26 @@ protected:
   Bool_t         fFirstPhysics;    // Status flag for physics analysis
 
   // Main analysis functions
+  virtual Int_t  AnalyzeEvent();
   virtual Int_t  BeginAnalysis();
   virtual Int_t  DoInit( THaRunBase* run );
   virtual Int_t  EndAnalysis();
   virtual Int_t  MainAnalysis();
   virtual Int_t  PhysicsAnalysis( Int_t code );
+  virtual Int_t  PoolEventLoop( UInt_t nlast, bool& terminate, bool& fatal );
   virtual Int_t  ScalerAnalysis( Int_t code );
   virtual Int_t  SlowControlAnalysis( Int_t code );
   virtual Int_t  OtherAnalysis( Int_t code );
   virtual Int_t  PostProcess( Int_t code );
+  virtual Int_t  ProcessSegment( THaRunBase* run, const char* outfile,
+				 const char* statfile );
   virtual Int_t  ReadOneEvent();
 
   // Support methods
   void           ClearCounters();
   Stage_t*       DefineStage( const Stage_t* stage );
   Counter_t*     DefineCounter( const Counter_t* counter );
+  void           EventDone( Int_t err, bool& terminate, bool& fatal );
   UInt_t         GetCount( Int_t which ) const;
   UInt_t         Incr( Int_t which );
   virtual bool   EvalStage( int n );
@@ -180,6 +200,9 @@ protected:
   virtual void   PrintCounters() const;
   virtual void   PrintScalers() const;
   virtual void   PrintCutSummary() const;
+  Int_t          ReadSegmentStats( const char* statfile,
+				   Double_t* benchtime = NULL );
+  Int_t          WriteSegmentStats( const char* statfile ) const;
 
   static THaAnalyzer* fgAnalyzer;  //Pointer to instance of this class
 
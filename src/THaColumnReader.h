@@ -0,0 +1,73 @@
+#ifndef ROOT_THaColumnReader
+#define ROOT_THaColumnReader
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaColumnReader
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+class TTree;
+
+class THaColumnReader : public TObject {
+
+public:
+  THaColumnReader( const char* filename = NULL );
+  virtual ~THaColumnReader();
+
+  Int_t        Open( const char* filename );
+  void         Close();
+  Bool_t       IsOpen()        const { return (fFile != NULL); }
+
+  Int_t        GetNcolumns()   const { return fColumns.size(); }
+  Int_t        GetNchunks()    const { return fChunkRows.size(); }
+  Long64_t     GetEntries()    const { return fNentries; }
+  Long64_t     GetChunkEntries( Int_t chunk ) const;
+  Int_t        FindColumn( const char* name ) const;
+  const char*  GetColumnName( Int_t col ) const;
+  Int_t        GetColumnType( Int_t col ) const;
+  Bool_t       IsArray( Int_t col ) const;
+
+  Int_t        ReadChunk( Int_t col, Int_t chunk, std::vector<char>& data,
+			  std::vector<Long64_t>* offsets = NULL );
+  Long64_t     ReadColumn( Int_t col, std::vector<Double_t>& values,
+			   std::vector<Long64_t>* offsets = NULL );
+  TTree*       ToTree( const char* name = "T", const char* title = NULL );
+
+  virtual void Print( Option_t* opt="" ) const;
+
+protected:
+
+  struct Column_t {
+    std::string name;
+    Int_t       type;     // kDouble...kByte
+    Int_t       size;     // Bytes per element
+    Bool_t      array;    // Variable number of elements per event
+    Int_t       stream;   // Index of the value stream within a chunk
+  };
+
+  std::ifstream*        fFile;      //! Input file
+  std::string           fFileName;  //  Name of input file
+  Long64_t              fNentries;  //  Total number of events
+  Int_t                 fNstreams;  //  Streams per chunk
+  std::vector<Column_t> fColumns;   //! Column definitions
+  std::vector<Long64_t> fChunkRows; //! Events in each chunk
+  std::vector<Long64_t> fIndex;     //! Position, stored and raw size of
+                                    //  each stream of each chunk
+
+  Int_t        ReadFooter();
+  Int_t        ReadStream( Int_t chunk, Int_t stream, std::vector<char>& buf );
+
+private:
+  THaColumnReader( const THaColumnReader& );
+  THaColumnReader& operator=( const THaColumnReader& );
+
+  ClassDef(THaColumnReader,0)  // Reader for files of THaColumnWriter
+};
+
+#endif
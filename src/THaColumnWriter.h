@@ -0,0 +1,85 @@
+#ifndef ROOT_THaColumnWriter
+#define ROOT_THaColumnWriter
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaColumnWriter
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "THaOutputWriter.h"
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+class TTree;
+
+class THaColumnWriter : public THaOutputWriter {
+
+public:
+  THaColumnWriter( Int_t compress = 0, UInt_t chunk = 10000 );
+  virtual ~THaColumnWriter();
+
+  Int_t          Open( const char* filename );
+  virtual Int_t  Define( const char* name, Int_t type, const void* addr );
+  virtual Int_t  DefineArray( const char* name, Int_t type,
+			      const void* const* addr, const Int_t* len );
+  virtual Int_t  Fill();
+  virtual Int_t  Flush();
+  virtual void   Close();
+  virtual Bool_t IsOpen() const { return (fFile != NULL); }
+
+  Int_t          GetCompress()  const { return fCompress; }
+  UInt_t         GetChunkSize() const { return fChunk; }
+  Long64_t       GetEntries()   const { return fNentries; }
+  Int_t          GetNcolumns()  const { return fColumns.size(); }
+
+  static Long64_t Convert( TTree* tree, const char* filename,
+			   Int_t compress = 0, UInt_t chunk = 10000 );
+  static char    TypeCode( Int_t type );
+  static Int_t   CodeType( char code );
+
+  static const char* const kMagic;  // File signature
+  static const UInt_t kByteOrder;   // Byte order mark
+  static const Int_t  kMaxBlock;    // Maximum size of a compressed block
+
+protected:
+
+  struct Column_t {
+    std::string        name;
+    Int_t              type;     // kDouble...kByte
+    Int_t              size;     // Bytes per element
+    const void*        addr;     // Scalar: address of the value
+    const void* const* parr;     // Array: address of the data pointer
+    const Int_t*       len;      // Array: address of the number of elements
+    std::vector<char>     data;  // Values in the current chunk
+    std::vector<Long64_t> offsets; // Array: end of each row in 'data'
+  };
+
+  std::ofstream*         fFile;      //! Output file
+  std::string            fFileName;  //  Name of output file
+  Int_t                  fCompress;  //  Compression level (0 = none)
+  UInt_t                 fChunk;     //  Events per chunk
+  UInt_t                 fNrows;     //  Events in the current chunk
+  Long64_t               fNentries;  //  Events filled
+  Long64_t               fDataEnd;   //  File position after the last chunk
+  Int_t                  fNstreams;  //  Streams per chunk
+  std::vector<Column_t>  fColumns;   //! Column definitions and data
+  std::vector<Long64_t>  fChunkRows; //! Events in each written chunk
+  std::vector<Long64_t>  fIndex;     //! Position, stored and raw size of
+                                     //  each stream of each chunk
+
+  Int_t          AddColumn( const char* name, Int_t type, const void* addr,
+			    const void* const* parr, const Int_t* len );
+  Int_t          WriteChunk();
+  void           WriteStream( const char* data, Long64_t nbytes );
+  void           WriteFooter();
+
+private:
+  THaColumnWriter( const THaColumnWriter& );
+  THaColumnWriter& operator=( const THaColumnWriter& );
+
+  ClassDef(THaColumnWriter,0)  // Columnar binary output file
+};
+
+#endif
@@ -9,40 +9,61 @@
 
 #include "THaFormula.h"
 #include "TString.h"
+#include <vector>
 
 class THaCut : public THaFormula {
 
 public:
-  THaCut() : THaFormula(), fLastResult(kFALSE), fNCalled(0), fNPassed(0) {}
+  THaCut() : THaFormula(), fLastResult(kFALSE), fPending(kFALSE),
+    fRequested(kFALSE), fNUsers(0), fNCalled(0), fNPassed(0) {}
   THaCut( const char* name, const char* expression, const char* block, 
 	  const THaVarList* vlst = gHaVars, const THaCutList* clst = gHaCuts );
   THaCut( const THaCut& rhs );
   THaCut& operator=( const THaCut& rhs );
   virtual ~THaCut() {}
 
-          void         ClearResult()        { fLastResult = kFALSE; }
+          void         AddCounts( UInt_t ncalled, UInt_t npassed )
+    { fNCalled += ncalled; fNPassed += npassed; }
+          void         AddUser();
+          void         ClearResult()
+    { fLastResult = kFALSE; fPending = kFALSE; }
 #if ROOT_VERSION_CODE >= 262144 // 4.00/00
   virtual Int_t        DefinedVariable( TString& variable, Int_t& action );
 #else
   virtual Int_t        DefinedVariable( TString& variable );
 #endif
   virtual Bool_t       EvalCut();
-          Bool_t       GetResult()    const { return fLastResult; }
+          Bool_t       GetResult()    const;
           const char*  GetBlockname() const { return fBlockname.Data(); }
+          Int_t        GetDependencies( std::vector<const THaCut*>& cuts,
+					std::vector<const THaVar*>& vars ) const;
           UInt_t       GetNCalled()   const { return fNCalled; }
           UInt_t       GetNPassed()   const { return fNPassed; }
+          Bool_t       IsPending()    const { return fPending; }
+          Bool_t       IsRequested()  const
+    { return fRequested || fNUsers > 0; }
   virtual void         Print( Option_t *opt="" ) const;
+          void         RemoveUser();
   virtual void         Reset();
   virtual void         SetBlockname( const Text_t* name );
   virtual void         SetName( const Text_t* name );
   virtual void         SetNameTitle( const Text_t *name, const Text_t *title );
+          void         SetPending()         { fPending = kTRUE; }
+          void         SetRequested( Bool_t req = kTRUE );
+
+  static  UInt_t       GetRequestGen()      { return fgRequestGen; }
 
 protected:
   Bool_t      fLastResult;   //Result of last evaluation of this formula
+  Bool_t      fPending;      //Evaluation requested, deferred until result used
+  Bool_t      fRequested;    //Result explicitly requested (master cut etc.)
+  UInt_t      fNUsers;       //Number of formulas outside the cut list using it
   TString     fBlockname;    //Name of block this cut belongs to
   UInt_t      fNCalled;      //Number of times this cut has been evaluated
   UInt_t      fNPassed;      //Number of times this cut was true when evaluated
 
+  static UInt_t fgRequestGen; //Incremented whenever IsRequested() changes
+
   ClassDef(THaCut,0)   //A logical cut (a.k.a. test)
 };
 
@@ -52,12 +73,61 @@ Bool_t THaCut::EvalCut()
 {
   // Evaluate the cut and increment counters
 
+  fPending = kFALSE;
   fNCalled++;
   fLastResult = ( Eval() > 0.5 );
   if( fLastResult ) fNPassed++;
   return fLastResult;
 }
 
+//_____________________________________________________________________________
+inline
+void THaCut::SetRequested( Bool_t req )
+{
+  // Mark this cut as needed, e.g. as a master cut of the analyzer.
+  // With lazy evaluation, requested cuts are always evaluated at their
+  // own stage (see THaCutList::SetLazyEval).
+
+  Bool_t was = IsRequested();
+  fRequested = req;
+  if( IsRequested() != was )
+    ++fgRequestGen;
+}
+
+//_____________________________________________________________________________
+inline
+void THaCut::AddUser()
+{
+  // Register a formula outside of the cut list (output, histogram, filter
+  // etc.) that uses this cut. Called by THaFormula::DefinedCut.
+
+  if( fNUsers++ == 0 && !fRequested )
+    ++fgRequestGen;
+}
+
+//_____________________________________________________________________________
+inline
+void THaCut::RemoveUser()
+{
+  // Unregister a formula that no longer uses this cut
+
+  if( fNUsers > 0 && --fNUsers == 0 && !fRequested )
+    ++fgRequestGen;
+}
+
+//_____________________________________________________________________________
+inline
+Bool_t THaCut::GetResult() const
+{
+  // Result of the last evaluation. If an evaluation is pending (see
+  // THaCutList::EvalBlock), the cut is evaluated now. Any cuts used in
+  // its expression are in turn evaluated on demand.
+
+  if( fPending )
+    const_cast<THaCut*>(this)->EvalCut();
+  return fLastResult;
+}
+
 //_____________________________________________________________________________
 inline
 void THaCut::Reset()
@@ -8,8 +8,11 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "THashList.h"
+#include <vector>
+#include <map>
 
 class TList;
+class THaVar;
 class THaVarList;
 class THaPrintOption;
 class THaNamedList;
@@ -71,6 +74,10 @@ public:
 				Option_t* option="" ) const;
   virtual void      Reset();
   virtual Int_t     Result( const char* cutname = "", EWarnMode mode=kWarn );
+          Bool_t    IsLazyEval()   const { return fLazyEval; }
+          void      SetLazyEval( Bool_t lazy = kTRUE ) { fLazyEval = lazy; }
+  virtual Int_t     Request( const char* cutname );
+  virtual void      PrintGraph();
   virtual Int_t     Remove( const char* cutname );
   virtual Int_t     RemoveBlock( const char* block=kDefaultBlockName );
   virtual void      SetList( THaVarList* lst );
@@ -80,12 +87,34 @@ protected:
   THaHashList*      fBlocks;  //Hash list holding blocks of cuts.
                               //Elements of this table are THaNamedLists of THaCuts
   const THaVarList* fVarList; //Pointer to list of variables
+  Bool_t            fLazyEval;//Evaluate only cuts whose result is used
 
   static  void      MakePrintOption( THaPrintOption& opt, 
 				     const TList* plist );
 
   virtual void      PrintHeader( const THaPrintOption& opt ) const;
 
+  // Dependency graph of the cuts, used for lazy evaluation
+  struct CutNode_t {
+    THaCut*                    cut;
+    const TList*               block;   // Block containing the cut
+    std::vector<UInt_t>        cuts;    // Nodes of the cuts this cut uses
+    std::vector<const THaVar*> vars;    // Global variables this cut uses
+    Bool_t                     needed;  // Result needed (see BuildGraph)
+    Bool_t                     atstage; // Evaluated at its stage in any case
+  };
+  struct EvalPlan_t {
+    std::vector<THaCut*>       needed;  // Needed cuts of a block, in order
+    std::vector<THaCut*>       atstage; // Those evaluated in any case
+  };
+  std::vector<CutNode_t>       fGraph;     //Nodes of the dependency graph
+  std::map<const TList*,EvalPlan_t> fPlans; //Lazy evaluation plan per block
+  Bool_t            fGraphOK;  //fGraph and fPlans are up to date
+  UInt_t            fGraphGen; //THaCut::GetRequestGen() at BuildGraph()
+
+  virtual void      BuildGraph();
+          void      UpdateGraph();
+
   ClassDef(THaCutList,0)  //Hash list of TCuts with support for blocks of cuts
 };
 
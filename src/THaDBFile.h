@@ -17,6 +17,7 @@
 
 #include<string>
 #include<vector>
+#include<map>
 #include<iostream>
 
 class THaDBFile : public THaDB {
@@ -115,6 +116,11 @@ class THaDBFile : public THaDB {
   
  protected:
   Int_t LoadDetMap(const TDatime& date);
+
+  // Sequential search of a stream, as used before the index. Kept for
+  // GetMatrix with named rows and for checking the index.
+  bool FindEntry( std::string& system, std::string& attr, std::istream& from,
+		  TDatime& date);
   
   std::string fInFileName;      // filename to read the calibration DB from
   std::string fOutFileName;     // filename to write the DB to
@@ -123,8 +129,6 @@ class THaDBFile : public THaDB {
 
  private:
   bool find_constant(std::istream& from, int linebreak=0);
-  bool FindEntry( std::string& system, std::string& attr, std::istream& from,
-		  TDatime& date);
 
   void WriteDate(std::ostream& to, const TDatime& date);
   bool IsDate(std::istream& from, std::streampos &pos, TDatime& date );
@@ -156,12 +160,42 @@ class THaDBFile : public THaDB {
 		       const std::vector<std::vector<T> >& matrix,
 		       TDatime date );
 
-  std::string db_contents; // everything in this database -- buffer for reading/writing
-  
+  // The database is kept as a list of sections, each starting with a
+  // date line (except the first), and an index of the entries by
+  // system/attribute. New entries are appended to the section valid for
+  // their date.
+  struct Section_t {
+    UInt_t      date;    // Time stamp of the section (TDatime::Get())
+    std::string text;    // Text of the section, starting with its date line
+  };
+  struct Entry_t {
+    UInt_t      section; // Id of the section containing the entry
+    UInt_t      begin;   // Offset of the data (after the attribute name)
+    UInt_t      end;     // Offset of the end of the entry
+  };
+  typedef std::pair<std::string,std::string> Key_t;  // system, attribute
+  typedef std::map< Key_t, std::vector<Entry_t> > Index_t;
+
+  std::vector<Section_t> fSections; // Sections by id
+  std::vector<UInt_t>    fOrder;    // Section ids in file order
+  std::vector<UInt_t>    fPos;      // Position in fOrder of each section id
+  std::vector<UInt_t>    fMaxDate;  // Latest time stamp up to each position
+  Index_t                fIndex;    // Entries of each key, in file order
+
+  std::string db_contents; // everything in this database -- joined sections
+  bool fJoined;            // db_contents is up to date
 
   int modified;
   bool NextLine( std::istream& from );
-  bool CopyDB(std::istream& from, std::ostream& to, std::streampos pos=-1);
+
+  void  AddText( const std::string& text, const TDatime& date );
+  void  BuildIndex();
+  Int_t FindSection( const TDatime& date ) const;
+  const std::string& GetContents();
+  void  IndexText( UInt_t sid, std::string::size_type start );
+  bool  LookupEntry( std::string& system, std::string& attr,
+		     const TDatime& date, std::string& data ) const;
+  void  UpdateOrder();
   
  public:
   ClassDef(THaDBFile,0) //  An ASCII file-based implementation of THaDB
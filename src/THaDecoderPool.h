@@ -0,0 +1,91 @@
+#ifndef ROOT_THaDecoderPool
+#define ROOT_THaDecoderPool
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaDecoderPool
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+class THaEvData;
+class THaRunBase;
+class TClass;
+class TThread;
+class TMutex;
+class TCondition;
+
+class THaDecoderPool : public TObject {
+
+public:
+  THaDecoderPool( UInt_t nthreads, UInt_t depth = 0 );
+  virtual ~THaDecoderPool();
+
+  Int_t        Init( TClass* decoder_class, THaEvData* master );
+  Int_t        Start( THaRunBase* run, Bool_t read_ahead = kFALSE );
+  void         Drain();
+  void         Stop();
+
+  Bool_t       IsInit()     const { return fIsInit; }
+  Bool_t       IsRunning()  const { return (fThreads != NULL); }
+  Bool_t       IsReadAhead()const { return (fReader != NULL); }
+  UInt_t       GetDepth()   const { return fDepth; }
+  UInt_t       GetNThreads()const { return fNThreads; }
+
+  THaEvData*   Front( Int_t& status );
+  void         Pop();
+
+  static void* WorkerThread( void* arg );
+  static void* ReaderThread( void* arg );
+
+protected:
+  enum ESlotState { kFree = 0, kQueued, kBusy, kDone, kHold };
+  enum EEventType { kNoEvent = 0, kPhysics, kOther };
+
+  struct EvSlot_t {
+    Int_t*       buffer;     // Copy of the raw event
+    UInt_t       bufsiz;     // Allocated size of buffer (words)
+    THaEvData*   evdata;     // Decoder owned by this slot
+    Int_t        status;     // Read status or return code of LoadEvent()
+    Int_t        state;      // Slot state (see ESlotState)
+    Int_t        type;       // Type of event in slot (see EEventType)
+  };
+
+  UInt_t         fNThreads;  // Number of worker threads
+  UInt_t         fDepth;     // Number of event slots
+  EvSlot_t*      fSlots;     // [fDepth] Ring of event slots
+  UInt_t         fHead;      // Index of oldest pending slot
+  UInt_t         fTail;      // Index of next slot to be filled
+  UInt_t         fNext;      // Index of next slot to be decoded
+  UInt_t         fNPending;  // Number of slots in use
+  UInt_t         fNQueued;   // Number of slots waiting for a worker
+  UInt_t         fNBusy;     // Number of slots being decoded
+  Bool_t         fStop;      // Request for all threads to exit
+  Bool_t         fEOF;       // End of input reached
+  Bool_t         fIsInit;    // Decoders created and initialized
+  THaEvData*     fMaster;    // Decoder of the caller, kept in sync
+  THaRunBase*    fRun;       // Input data source
+
+  TThread**      fThreads;   // [fNThreads] Worker threads
+  TThread*       fReader;    // Read-ahead thread (optional)
+  TMutex*        fMutex;     // Protects all the above
+  TCondition*    fWorkCond;  // Signals new work for the workers
+  TCondition*    fDoneCond;  // Signals a slot ready for the consumer
+  TCondition*    fFreeCond;  // Signals a free slot for the reader
+
+  void           DecodeLoop();
+  void           DeleteDecoders();
+  void           ReadLoop();
+  Int_t          ReadEvent();
+  void           Reset();
+  Int_t          SyncDecoders();
+
+private:
+  THaDecoderPool( const THaDecoderPool& );
+  THaDecoderPool& operator=( const THaDecoderPool& );
+
+  ClassDef(THaDecoderPool,0)  // Pipelined, multi-threaded event reading and decoding
+};
+
+#endif
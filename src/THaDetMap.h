@@ -23,6 +23,8 @@
 #include "Rtypes.h"
 #include <vector>
 
+class THaEvData;
+
 class THaDetMap {
 
 protected:
@@ -58,6 +60,14 @@ public:
     void   MakeADC()  { model |= kADCBit; }
   };
 
+  // A hit channel of the current event, see LoadHits()
+  struct Hit {
+    UShort_t     imod;   // Index of the module in this map
+    UShort_t     chan;   // Physical channel number
+    Int_t        nhit;   // Number of hits on this channel
+    const Int_t* data;   // The nhit data words (owned by the decoder)
+  };
+
   // Flags for GetMinMaxChan()
   enum ECountMode {
     kLogicalChan         = 0,
@@ -81,7 +91,7 @@ public:
 			       UShort_t chan_lo, UShort_t chan_hi,
 			       UInt_t first=0, UInt_t model=0,
 			       Int_t refindex=-1, Int_t refchan = -1 );
-          void      Clear()  { fNmodules = 0; }
+          void      Clear();
   virtual Module*   Find( UShort_t crate, UShort_t slot, UShort_t chan );
   virtual Int_t     Fill( const std::vector<Int_t>& values, UInt_t flags = 0 );
           void      GetMinMaxChan( Int_t& min, Int_t& max,
@@ -102,6 +112,14 @@ public:
   virtual void      Reset();
   virtual void      Sort();
 
+  // Per-event hit lists
+          void      EnableHitLists( Bool_t enable = kTRUE );
+          Bool_t    HasHitLists() const { return fHitLists; }
+          Int_t     LoadHits( const THaEvData& evdata );
+          Int_t     GetNhits() const { return fNhits; }
+          const Hit& GetHit( Int_t i ) const { return fHits[i]; }
+  static  Int_t     LoadAllHits( const THaEvData& evdata );
+
   static const int kDetMapSize = (1<<16)-1;  //Sanity limit on map size
 
 protected:
@@ -112,8 +130,16 @@ protected:
                            // model,refindex)
 
   Int_t        fMaplength; // current size of the fMap array
-  
+
+  Bool_t       fHitLists;  // Hit lists are filled via the global index
+  Int_t        fNhits;     // Number of hit channels in the current event
+  Hit*         fHits;      //! Hit channels of the current event
+  Int_t        fHitsize;   // current size of the fHits array
+
   Module*      uGetModule( UShort_t i ) const { return fMap+i; }
+          void AddHit( UShort_t imod, UShort_t chan, Int_t nhit,
+		       const Int_t* data );
+          void MapChanged();
 
   ClassDef(THaDetMap,0)   //The standard detector map
 };
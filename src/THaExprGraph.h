@@ -0,0 +1,70 @@
+#ifndef ROOT_THaExprGraph
+#define ROOT_THaExprGraph
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaExprGraph
+//
+// Shared expression graph of compiled formulas and cuts.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include <vector>
+#include <map>
+
+class THaFormula;
+
+class THaExprGraph {
+
+public:
+  THaExprGraph();
+  virtual ~THaExprGraph();
+
+  Bool_t   Add( THaFormula* f );
+  void     Clear();
+  Int_t    GetNformulas() const { return fFormulas.size(); }
+  Int_t    GetNdefined()  const { return fNdefined; }
+  Int_t    GetNnodes()    const { return fNodes.size(); }
+  void     NextEvent()          { ++fEpoch; }
+  void     Print( Option_t* opt="" ) const;
+  void     Remove( THaFormula* f );
+  Double_t Value( Int_t node );
+
+protected:
+
+  struct Node_t {
+    Int_t       op;        // Opcode (EFOpcode, see THaFormulaOps.h)
+    Int_t       a, b;      // Operand nodes (-1 = none)
+    Int_t       idx;       // Array index of variable
+    Double_t    c;         // Constant
+    const void* p;         // Data pointer, THaVar* or THaCut*
+    bool operator<( const Node_t& rhs ) const;
+  };
+
+  std::vector<Node_t>      fNodes;    //! Nodes, operands before their users
+  std::vector<Double_t>    fValue;    //! Node values
+  std::vector<UInt_t>      fStamp;    //! Event in which fValue was computed
+  std::map<Node_t,Int_t>   fIndex;    //! Node lookup for deduplication
+  std::vector<THaFormula*> fFormulas; //! Formulas evaluated via this graph
+  UInt_t                   fEpoch;    //  Current event
+  Int_t                    fNdefined; //  Nodes requested before deduplication
+
+  Int_t    AddNode( Node_t& node );
+  Bool_t   Build( const THaFormula* f, Int_t begin, Int_t end,
+		  std::vector<Int_t>& reg );
+  Double_t Evaluate( Int_t node );
+
+  ClassDef(THaExprGraph,0)  // Shared expression graph of formulas and cuts
+};
+
+//_____________________________________________________________________________
+inline
+Double_t THaExprGraph::Value( Int_t node )
+{
+  // Value of 'node' in the current event. Computed at most once per event.
+
+  return (fStamp[node] == fEpoch) ? fValue[node] : Evaluate(node);
+}
+
+#endif
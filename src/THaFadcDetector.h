@@ -0,0 +1,53 @@
+#ifndef ROOT_THaFadcDetector
+#define ROOT_THaFadcDetector
+
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// THaFadcDetector                                                           //
+//                                                                           //
+// Flash ADC channels with software pulse analysis.                          //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "THaNonTrackingDetector.h"
+
+class THaFadcDetector : public THaNonTrackingDetector {
+
+public:
+  THaFadcDetector( const char* name, const char* description = "",
+		   THaApparatus* a = NULL );
+  virtual ~THaFadcDetector();
+
+  virtual Int_t      Decode( const THaEvData& );
+  virtual Int_t      CoarseProcess( TClonesArray& ) { return 0; }
+  virtual Int_t      FineProcess( TClonesArray& )   { return 0; }
+
+protected:
+
+  // Parameters of the pulse analysis
+  Int_t      fNped;       // Number of samples for pedestal
+  Int_t      fThreshold;  // Pulse threshold above pedestal (ADC counts)
+  Int_t      fNSB;        // Samples to integrate before threshold crossing
+  Int_t      fNSA;        // Samples to integrate after threshold crossing
+
+  // Per-event data
+  Int_t      fNhit;       // Number of channels with a pulse
+  Int_t*     fNsamp;      // [fNelem] Number of samples
+  Double_t*  fPed;        // [fNelem] Pedestal
+  Double_t*  fIntegral;   // [fNelem] Pedestal-subtracted pulse integral
+  Double_t*  fPeak;       // [fNelem] Peak amplitude above pedestal
+  Double_t*  fTime;       // [fNelem] Leading-edge time (ns)
+  Int_t*     fFwIntegral; // [fNelem] Firmware integral of first pulse
+  Int_t*     fFwTime;     // [fNelem] Firmware time of first pulse
+
+          void   ClearEvent();
+  virtual Int_t  DefineVariables( EMode mode = kDefine );
+          void   DeleteArrays();
+  virtual Int_t  ReadDatabase( const TDatime& date );
+
+  ClassDef(THaFadcDetector,0)    // Flash ADC channels with pulse analysis
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -14,6 +14,7 @@
 class THaVarList;
 class THaCutList;
 class THaVar;
+class THaExprGraph;
 
 class THaFormula : public TFormula {
 
@@ -22,7 +23,9 @@ public:
   static const Option_t* const kPRINTBRIEF;
 
   THaFormula() : TFormula(), fNcodes(0), fVarDef(NULL), fVarList(NULL), 
-    fCutList(NULL), fError(kFALSE), fRegister(kTRUE) {}
+    fCutList(NULL), fError(kFALSE), fRegister(kTRUE), fRequestCuts(kTRUE),
+    fCode(NULL),
+    fNinstr(0), fReg(NULL), fNreg(0), fGraph(NULL), fNode(-1) {}
   THaFormula( const char* name, const char* formula, 
 	      const THaVarList* vlst=gHaVars, const THaCutList* clst=gHaCuts );
   THaFormula( const THaFormula& rhs );
@@ -56,6 +59,7 @@ public:
   { return Eval(); }
 #endif
           Bool_t      IsError() const { return fError; }
+          Bool_t      IsCompiled() const { return (fNinstr > 0); }
 #if ROOT_VERSION_CODE >= 197895 // 3.05/07
 #if ROOT_VERSION_CODE >= 331776 // 5.16/00
   virtual TString     GetExpFormula( Option_t* opt="" ) const;
@@ -66,6 +70,7 @@ public:
   virtual void        Print( Option_t* option="" ) const; // *MENU*
           void        SetList( const THaVarList* lst )    { fVarList = lst; }
           void        SetCutList( const THaCutList* lst ) { fCutList = lst; }
+          void        SetRequestCuts( Bool_t b );
 
 protected:
 
@@ -85,8 +90,30 @@ protected:
   const THaCutList* fCutList;          //Pointer to list of cuts
   Bool_t            fError;            //Flag indicating error in expression
   Bool_t            fRegister;         //If true, register this formula in ROOT's global list
+  Bool_t            fRequestCuts;      //If true, register as user of the cuts in the expression
+
+  // Compiled form of the expression, evaluated by Eval() instead of
+  // TFormula::EvalPar if available
+  struct FInstr_t;
+  class  FCompiler;
+  friend class FCompiler;
+  FInstr_t*         fCode;             //! Bytecode
+  Int_t             fNinstr;           //  Number of bytecode instructions
+  Double_t*         fReg;              //! Registers
+  Int_t             fNreg;             //  Number of registers
+
+  // Expression graph this formula is part of, if any (see THaExprGraph)
+  friend class THaExprGraph;
+  THaExprGraph*     fGraph;            //! Shared expression graph
+  Int_t             fNode;             //  Node of this formula in fGraph
 
   virtual Bool_t IsString( Int_t oper ) const;
+          void   AddCutUsers();
+          void   RemoveCutUsers();
+          void   CompileCode();
+          void   CopyCode( const THaFormula& rhs );
+          void   DeleteCode();
+          Double_t EvalCode();
 
   ClassDef(THaFormula,0)  //Formula defined on list of variables
 };
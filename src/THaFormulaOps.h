@@ -0,0 +1,176 @@
+#ifndef ROOT_THaFormulaOps
+#define ROOT_THaFormulaOps
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaFormulaOps
+//
+// Opcodes of compiled formulas and the function that executes a single
+// operation. Shared by the THaFormula bytecode interpreter and the
+// expression graph of THaExprGraph. Internal header, not for use by
+// analysis code.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "THaFormula.h"
+#include "THaVar.h"
+#include "THaCut.h"
+#include "TMath.h"
+
+enum EFOpcode {
+  kOpConst,
+  // Load element of a basic variable through direct pointer (order of
+  // kDouble ... kByte, see VarType.h)
+  kOpLdD, kOpLdF, kOpLdL, kOpLdX, kOpLdI, kOpLdU, kOpLdS, kOpLdW, kOpLdC,
+  kOpLdB,
+  // Load element idx of a heap array through pointer to the array pointer
+  // (order of kDoubleP ... kByteP)
+  kOpLdPD, kOpLdPF, kOpLdPL, kOpLdPX, kOpLdPI, kOpLdPU, kOpLdPS, kOpLdPW,
+  kOpLdPC, kOpLdPB,
+  kOpLdVar,   // Any other variable, via THaVar::GetValue
+  kOpLdCut,   // Result of a cut
+  // Binary operations
+  kOpAdd, kOpSub, kOpMul, kOpDiv, kOpMod, kOpPow, kOpLt, kOpLe, kOpGt,
+  kOpGe, kOpEq, kOpNe, kOpBitAnd, kOpBitOr, kOpShl, kOpShr, kOpAtan2,
+  kOpMin, kOpMax,
+  // Unary operations
+  kOpNeg, kOpNot, kOpBool, kOpSqrt, kOpSq, kOpAbs, kOpExp, kOpLog, kOpLog10,
+  kOpSin, kOpCos, kOpTan, kOpAsin, kOpAcos, kOpAtan, kOpSinh, kOpCosh,
+  kOpTanh, kOpInt, kOpSign,
+  kOpJmpF,    // Jump to idx if r[a] is false
+  kOpJmpT,    // Jump to idx if r[a] is true
+  // Short-circuit logical operations of the expression graph
+  kOpAnd, kOpOr
+};
+
+// Bytecode of compiled formulas
+//
+// Each instruction writes register r[dst]. Binary operations read r[a] and
+// r[b], unary ones r[a]. Registers are assigned by expression depth, so
+// that the operands of an operation at depth d are in r[d] and r[d+1].
+// Variables are loaded through typed pointers bound at compile time.
+
+struct THaFormula::FInstr_t {
+  Int_t op;                 // Opcode (EFOpcode)
+  Int_t dst, a, b;          // Registers
+  Int_t idx;                // Array index or jump target
+  union {
+    Double_t    c;          // Constant
+    const void* p;          // Data pointer, THaVar* or THaCut*
+  };
+};
+
+inline Bool_t IsLoadOp( Int_t op )   { return op <= kOpLdCut; }
+inline Bool_t IsBinaryOp( Int_t op ) { return op >= kOpAdd && op <= kOpMax; }
+inline Bool_t IsUnaryOp( Int_t op )  { return op >= kOpNeg && op <= kOpSign; }
+
+//_____________________________________________________________________________
+template< typename T > inline
+Double_t LoadDirect( const void* p )
+{
+  return static_cast<Double_t>( *static_cast<const T*>(p) );
+}
+
+//_____________________________________________________________________________
+template< typename T > inline
+Double_t LoadIndirect( const void* p, Int_t i )
+{
+  return static_cast<Double_t>( (*static_cast<const T* const*>(p))[i] );
+}
+
+//_____________________________________________________________________________
+template< typename Instr > inline
+Double_t Operate( const Instr& in, Double_t x, Double_t y )
+{
+  // Execute load, unary or binary operation 'in' with operands x and y.
+  // Same results as TFormula::EvalPar, including its conventions for
+  // division by zero and out-of-domain function arguments.
+  // Jumps and logical operations must be handled by the caller.
+
+  switch( in.op ) {
+  case kOpConst:  return in.c;
+  case kOpLdD:    return LoadDirect<Double_t>(in.p);
+  case kOpLdF:    return LoadDirect<Float_t>(in.p);
+  case kOpLdL:    return LoadDirect<Long64_t>(in.p);
+  case kOpLdX:    return LoadDirect<ULong64_t>(in.p);
+  case kOpLdI:    return LoadDirect<Int_t>(in.p);
+  case kOpLdU:    return LoadDirect<UInt_t>(in.p);
+  case kOpLdS:    return LoadDirect<Short_t>(in.p);
+  case kOpLdW:    return LoadDirect<UShort_t>(in.p);
+  case kOpLdC:    return LoadDirect<Char_t>(in.p);
+  case kOpLdB:    return LoadDirect<Byte_t>(in.p);
+  case kOpLdPD:   return LoadIndirect<Double_t>(in.p,in.idx);
+  case kOpLdPF:   return LoadIndirect<Float_t>(in.p,in.idx);
+  case kOpLdPL:   return LoadIndirect<Long64_t>(in.p,in.idx);
+  case kOpLdPX:   return LoadIndirect<ULong64_t>(in.p,in.idx);
+  case kOpLdPI:   return LoadIndirect<Int_t>(in.p,in.idx);
+  case kOpLdPU:   return LoadIndirect<UInt_t>(in.p,in.idx);
+  case kOpLdPS:   return LoadIndirect<Short_t>(in.p,in.idx);
+  case kOpLdPW:   return LoadIndirect<UShort_t>(in.p,in.idx);
+  case kOpLdPC:   return LoadIndirect<Char_t>(in.p,in.idx);
+  case kOpLdPB:   return LoadIndirect<Byte_t>(in.p,in.idx);
+  case kOpLdVar:  return static_cast<const THaVar*>(in.p)->GetValue(in.idx);
+  case kOpLdCut:  return static_cast<const THaCut*>(in.p)->GetResult();
+
+  case kOpAdd:    return x + y;
+  case kOpSub:    return x - y;
+  case kOpMul:    return x * y;
+  case kOpDiv:    return (y == 0) ? 0.0 : x / y;
+  case kOpMod: {
+    // Integer modulo in Int_t, as in TFormula
+    Int_t i1 = static_cast<Int_t>(x);
+    Int_t i2 = static_cast<Int_t>(y);
+    return (i2 == 0) ? 0.0 : static_cast<Double_t>(i1 % i2);
+  }
+  case kOpPow:    return TMath::Power( x, y );
+  case kOpLt:     return (x <  y);
+  case kOpLe:     return (x <= y);
+  case kOpGt:     return (x >  y);
+  case kOpGe:     return (x >= y);
+  case kOpEq:     return (x == y);
+  case kOpNe:     return (x != y);
+  case kOpBitAnd:
+    return static_cast<Double_t>( static_cast<Long64_t>(x) &
+				  static_cast<Long64_t>(y) );
+  case kOpBitOr:
+    return static_cast<Double_t>( static_cast<Long64_t>(x) |
+				  static_cast<Long64_t>(y) );
+  case kOpShl:
+    return static_cast<Double_t>( static_cast<Long64_t>(x) <<
+				  static_cast<Long64_t>(y) );
+  case kOpShr:
+    return static_cast<Double_t>( static_cast<Long64_t>(x) >>
+				  static_cast<Long64_t>(y) );
+  case kOpAtan2:  return TMath::ATan2( x, y );
+  case kOpMin:    return TMath::Min( x, y );
+  case kOpMax:    return TMath::Max( x, y );
+
+  case kOpNeg:    return -x;
+  case kOpNot:    return (x == 0);
+  case kOpBool:   return (x != 0);
+  case kOpSqrt:   return TMath::Sqrt( TMath::Abs(x) );
+  case kOpSq:     return x*x;
+  case kOpAbs:    return TMath::Abs(x);
+  case kOpExp:
+    return (x < -700) ? 0.0 : TMath::Exp( (x > 709) ? 709 : x );
+  case kOpLog:    return (x > 0) ? TMath::Log(x) : 0.0;
+  case kOpLog10:  return (x > 0) ? TMath::Log10(x) : 0.0;
+  case kOpSin:    return TMath::Sin(x);
+  case kOpCos:    return TMath::Cos(x);
+  case kOpTan: {
+    Double_t cs = TMath::Cos(x);
+    return (cs == 0) ? 0.0 : TMath::Sin(x)/cs;
+  }
+  case kOpAsin:   return (TMath::Abs(x) > 1) ? 0.0 : TMath::ASin(x);
+  case kOpAcos:   return (TMath::Abs(x) > 1) ? 0.0 : TMath::ACos(x);
+  case kOpAtan:   return TMath::ATan(x);
+  case kOpSinh:   return TMath::SinH(x);
+  case kOpCosh:   return TMath::CosH(x);
+  case kOpTanh:   return TMath::TanH(x);
+  case kOpInt:    return static_cast<Double_t>( static_cast<Int_t>(x) );
+  case kOpSign:   return (x < 0) ? -1.0 : 1.0;
+  }
+  return 1e38;   // Error value, as in THaFormula
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef ROOT_THaInitScheduler
+#define ROOT_THaInitScheduler
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaInitScheduler
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+
+class THaAnalysisObject;
+class TDatime;
+class TMutex;
+class TCondition;
+
+class THaInitScheduler : public TObject {
+
+public:
+  THaInitScheduler( UInt_t nthreads );
+  virtual ~THaInitScheduler();
+
+  Int_t         Run( const std::vector<THaAnalysisObject*>& modules,
+		     const TDatime& run_time, Int_t& failed );
+  UInt_t        GetNThreads() const { return fNThreads; }
+  void          ClearDependencies() { fDeps.clear(); }
+  virtual void  Print( Option_t* opt="" ) const;
+
+  static void   WaitForInit( THaAnalysisObject* module );
+  static void*  WorkerThread( void* arg );
+
+protected:
+  enum ETaskState { kPending = 0, kRunning, kDone };
+
+  struct Task_t {
+    THaAnalysisObject*  module;
+    Int_t               state;   // See ETaskState
+    Int_t               retval;  // Result of the module's Init()
+    std::vector<UInt_t> deps;    // Earlier tasks this one is known to need
+  };
+
+  typedef std::map< std::string, std::set<std::string> > DepMap_t;
+
+  UInt_t              fNThreads; // Maximum number of worker threads
+  const TDatime*      fDate;     // Run time to initialize for
+  std::vector<Task_t> fTasks;    // Modules being initialized
+  std::map<Long_t,Int_t> fCurrent; // Task being run by each thread
+  Bool_t              fAbort;    // A module failed; start no new tasks
+  DepMap_t            fDeps;     // Dependencies seen in earlier runs
+  TMutex*             fMutex;    // Protects all the above
+  TCondition*         fDoneCond; // Signals a finished task
+
+  Int_t         NextTask() const;
+  void          RunTask( UInt_t itask );
+  void          Wait( THaAnalysisObject* module );
+  void          WorkLoop();
+
+  static THaInitScheduler* fgActive; // Scheduler currently running, if any
+
+private:
+  THaInitScheduler( const THaInitScheduler& );
+  THaInitScheduler& operator=( const THaInitScheduler& );
+
+  ClassDef(THaInitScheduler,0)  // Concurrent initialization of analysis modules
+};
+
+#endif
@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "Rtypes.h"
+#include "VarType.h"
 #include <vector>
 #include <map>
 #include <string> 
@@ -25,14 +26,18 @@ class TTree;
 class THaOdata {
 // Utility class used by THaOutput to store arrays 
 // up to size 'nsize' for tree output.
+// If 'type' is not kDouble, the elements in 'data' are stored as that
+// type (see THaOutput storage options). Only Fill(const THaVar&) can be
+// used then.
 public:
-  THaOdata(int n=1) : tree(NULL), ndata(0), nsize(n)
+  THaOdata(int n=1) : tree(NULL), ndata(0), nsize(n), type(kDouble), prec(0)
   { data = new Double_t[n]; }
   THaOdata(const THaOdata& other);
   THaOdata& operator=(const THaOdata& rhs);
   virtual ~THaOdata() { delete [] data; };
   void AddBranches(TTree* T, std::string name);
   void Clear( Option_t* ="" ) { ndata = 0; }  
+  enum { kMaxIndex = 4096 };  // Largest index that Resize accepts
   Bool_t Resize(Int_t i);
   Int_t Fill(Int_t i, Double_t dat) {
     if( i<0 || (i>=nsize && Resize(i)) ) return 0;
@@ -47,6 +52,7 @@ public:
     return 1;
   }
   Int_t Fill(Double_t dat) { return Fill(0, dat); };
+  Int_t Fill(const THaVar& var);
   Double_t Get(Int_t index=0) {
     if( index<0 || index>=ndata ) return 0;
     return data[index];
@@ -57,15 +63,50 @@ public:
   Int_t       ndata;   // Number of array elements
   Int_t       nsize;   // Maximum number of elements
   Double_t*   data;    // [ndata] Array data
+  Int_t       type;    // Type of the data in the tree (kDouble...kByte)
+  Double_t    prec;    // Rounding step for kFloat data (0 = none)
 
 private:
 
   //  ClassDef(THaOdata,3)  // Variable sized array
 };
 
+class THaOblock {
+// Utility class used by THaOutput: variables that are written to a
+// separate tree, for events passing a cut ("begin tree" in output.def).
+public:
+  THaOblock(const std::string& n, const std::string& c) 
+    : name(n), cutexpr(c), cut(NULL), tree(NULL), var(NULL), evnum(0),
+      entry(0) {}
+  virtual ~THaOblock();
+
+  std::string name;     // Name of the tree
+  std::string cutexpr;  // Expression of the gating cut (empty = none)
+  THaVform*   cut;      // Gating cut
+  TTree*      tree;     // Tree for the data
+  std::vector<std::string> varnames;  // Variables from output.def
+  std::map<std::string, std::pair<Int_t,Double_t> > storage; // Options
+  std::vector<std::string> vnames, arraynames; // Scalars and arrays
+  std::vector<THaVar*>     vars, arrays;
+  std::vector<Int_t>       varhandles, arrayhandles;
+  std::vector<Int_t>       vartype;   // Tree type of scalars
+  std::vector<Double_t>    varprec;   // Rounding step of kFloat scalars
+  Double_t*   var;      // [vnames.size()] Scalar data
+  std::vector<THaOdata*>   odata;     // Array data
+  Int_t       evnum;    // Event number
+  Long64_t    entry;    // Entry of the event in the main tree
+
+private:
+  THaOblock(const THaOblock&);
+  THaOblock& operator=(const THaOblock&);
+};
+
 
 class THaEpicsKey;
 class THaScalerKey;
+class THaExprGraph;
+class THaTreeWriter;
+class THaOutputWriter;
 
 class THaOutput {
   
@@ -81,6 +122,7 @@ public:
   virtual Int_t End();
   virtual Bool_t TreeDefined() const { return fTree != 0; };
   virtual TTree* GetTree() const { return fTree; };
+  virtual void   AddWriter(THaOutputWriter* writer);
 
   static void SetVerbosity( Int_t level );
   
@@ -88,10 +130,22 @@ protected:
 
   virtual Int_t LoadFile( const char* filename );
   virtual Int_t Attach();
+  virtual void  BuildGraph();
+  virtual void  SetupTree();
+  virtual void  StopWriter();
+  void SetOdataTree(TTree* tree);
+  virtual void  DefineOutput(THaOutputWriter* writer);
   virtual Int_t FindKey(const std::string& key) const;
   virtual void  ErrFile(Int_t iden, const std::string& sline) const;
   virtual Int_t ChkHistTitle(Int_t key, const std::string& sline);
   virtual Int_t BuildBlock(const std::string& blockn);
+  virtual Int_t ParseStorage(const std::vector<std::string>& strvect,
+			     std::pair<Int_t,Double_t>& spec) const;
+  void GetStorage(const std::string& name, Int_t& type, Double_t& prec,
+		  const THaOblock* blk = NULL) const;
+  virtual Int_t InitBlock(THaOblock* blk);
+  virtual void  AttachBlock(THaOblock* blk);
+  virtual void  FillBlock(THaOblock* blk);
   virtual std::string StripBracket(const std::string& var) const; 
   std::vector<std::string> reQuote(const std::vector<std::string> input) const;
   std::string CleanEpicsName(const std::string& var) const;
@@ -108,17 +162,43 @@ protected:
                            fCutnames, fCutdef,
                            fArrayNames, fVNames; 
   std::vector<THaVar* >  fVariables, fArrays;
+  std::vector<Int_t>     fVarHandles, fArrayHandles; // see THaVarList::GetHandle
+  std::vector<Int_t>     fVarType;   // Tree type of scalar variables (VarType)
+  std::vector<Double_t>  fVarPrec;   // Rounding step of kFloat scalars
+  // Storage option (EStorage, precision) of variables from output.def
+  std::map<std::string, std::pair<Int_t,Double_t> > fStorage;
+  std::vector<THaOblock*> fBlocks;   // Cut-gated secondary trees
+  THaOblock* fCurBlock;   // Block being defined in LoadFile
+  THaVar*    fEvnumVar;   // Event number (g.evnum)
+  Long64_t   fNentries;   // Number of events filled into fTree
   std::vector<THaVform* > fFormulas, fCuts;
+  std::vector<THaVform* > fTreeForms; // Formulas and cuts in the output
   std::vector<THaVhist* > fHistos;
+  THaExprGraph* fGraph;   // Shared subexpressions of formulas/cuts/histos
   std::vector<THaOdata* > fOdata;
   std::vector<THaEpicsKey*>  fEpicsKey;
   std::vector<THaScalerKey*> fScalerKey;
   TTree *fTree, *fEpicsTree; 
+  THaTreeWriter* fWriter; // Background writer of fTree (optional)
+  // Settings of fTree from output.def
+  Int_t  fCompress;       // Compression level (-1 = that of the file)
+  Int_t  fCompAlg;        // Compression algorithm (0 = that of the file)
+  Int_t  fBasketSize;     // Basket size of the branches (bytes)
+  UInt_t fAsyncDepth;     // Chunks queued for the writer (0 = no writer)
+  UInt_t fAsyncChunk;     // Events per chunk
+  Bool_t fTreeSetup;      // SetupTree() done
+  // Additional output formats
+  std::vector<THaOutputWriter*> fOutWriters;
+  std::string fColFile;   // Column file from output.def (THaColumnWriter)
+  Int_t  fColCompress;    // Its compression level
+  UInt_t fColChunk;       // Its events per chunk
   std::map<std::string, TTree*> fScalTree;
   bool fInit;
   
   enum EId {kVar = 1, kForm, kCut, kH1f, kH1d, kH2f, kH2d, kBlock,
-            kBegin, kEnd, kRate, kCount };
+            kBegin, kEnd, kRate, kCount, kCompress, kBasket, kAsync,
+            kColumns };
+  enum EStorage { kStoreDouble = 0, kStoreFloat, kStoreNative };
   static const Int_t kNbout = 4000;
   static const Int_t fgNocut = -1;
 
@@ -0,0 +1,37 @@
+#ifndef ROOT_THaOutputWriter
+#define ROOT_THaOutputWriter
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaOutputWriter
+//
+// Abstract interface of output formats for THaOutput, besides the
+// ROOT tree.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+class THaOutputWriter : public TObject {
+
+public:
+  THaOutputWriter() {}
+  virtual ~THaOutputWriter() {}
+
+  // Define a scalar of type 'type' (kDouble...kByte) at 'addr'
+  virtual Int_t  Define( const char* name, Int_t type, const void* addr ) = 0;
+  // Define an array of type 'type' with *len elements at *addr.
+  // Both the data pointer and the length may change from event to event.
+  virtual Int_t  DefineArray( const char* name, Int_t type,
+			      const void* const* addr, const Int_t* len ) = 0;
+  // Write the current values of all defined data
+  virtual Int_t  Fill() = 0;
+  // Write out all filled events. More events may be filled afterwards.
+  virtual Int_t  Flush() = 0;
+  virtual void   Close() = 0;
+  virtual Bool_t IsOpen() const = 0;
+
+  ClassDef(THaOutputWriter,0)  // ABC for output formats of THaOutput
+};
+
+#endif
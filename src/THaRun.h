@@ -9,6 +9,8 @@
 
 #include "THaCodaRun.h"
 
+class THaCodaIndex;
+
 class THaRun : public THaCodaRun {
   
 public:
@@ -19,20 +21,34 @@ public:
   
   virtual void         Clear( Option_t* opt="" );
   virtual Int_t        Compare( const TObject* obj ) const;
+          void         EnableIndex( Bool_t b = kTRUE );
           const char*  GetFilename() const { return fFilename.Data(); }
           Int_t        GetSegment()  const { return fSegment; }
+          Bool_t       IndexEnabled() const { return fUseIndex; }
+          Bool_t       IsMmap()      const { return fUseMmap; }
   virtual Int_t        Open();
   virtual void         Print( Option_t* opt="" ) const;
+  virtual Int_t        ReadEvent();
   virtual Int_t        SetFilename( const char* name );
+          void         SetMmap( Bool_t b = kTRUE );
           void         SetNscan( UInt_t n );
+  virtual Int_t        SkipToEvent( UInt_t evnum );
 
 protected:
 
   TString       fFilename;     //  File name
   UInt_t        fMaxScan;      //  Max. no. of events to prescan (0=don't scan)
   Int_t         fSegment;      //  Segment number (for split runs)
-
+  Bool_t        fUseMmap;      //! Read file via memory mapping
+  Bool_t        fUseIndex;     //! Use event index to skip events
+  Bool_t        fIndexing;     //! Index being built while reading
+  Int_t         fIndexPos;     //! Index entry of next event to read
+  Int_t         fSkipTo;       //! Index entry to skip to (-1=none)
+  THaCodaIndex* fIndex;        //! Event index of the file
+
+          Int_t BuildIndex();
           Int_t FindSegmentNumber();
+          void  InitIndex();
   virtual Int_t ReadInitInfo();
 
   ClassDef(THaRun,6)           // A run based on a CODA data file on disk
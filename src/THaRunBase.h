@@ -52,6 +52,7 @@ public:
   THaRunParameters*    GetParameters()  const { return fParam; }
   virtual Bool_t       HasInfo( UInt_t bits ) const;
   virtual Bool_t       HasInfoRead( UInt_t bits ) const;
+  virtual void         InheritInfo( const THaRunBase& run );
           Bool_t       IsInit()         const { return fIsInit; }
   virtual Bool_t       IsOpen()         const;
   virtual void         Print( Option_t* opt="" ) const;
@@ -63,6 +64,7 @@ public:
           void         SetEventRange( UInt_t first, UInt_t last );
   virtual void         SetNumber( Int_t number );
   virtual void         SetType( Int_t type );
+  virtual Int_t        SkipToEvent( UInt_t evnum );
   virtual Int_t        Update( const THaEvData* evdata );
 
   enum EInfoType { kDate      = BIT(0), 
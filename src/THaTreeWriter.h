@@ -0,0 +1,65 @@
+#ifndef ROOT_THaTreeWriter
+#define ROOT_THaTreeWriter
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaTreeWriter
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+class TTree;
+class TThread;
+class TMutex;
+class TCondition;
+
+class THaTreeWriter : public TObject {
+
+public:
+  THaTreeWriter( TTree* tree, UInt_t depth = 2, UInt_t chunk = 1000 );
+  virtual ~THaTreeWriter();
+
+  Int_t        Start();
+  void         Stop();
+  Int_t        Fill();
+  void         LockFile();
+  void         UnLockFile();
+
+  TTree*       GetTree()      const { return fTree; }
+  TTree*       GetTemplate()  const { return fTemplate; }
+  UInt_t       GetDepth()     const { return fDepth; }
+  UInt_t       GetChunkSize() const { return fChunk; }
+  Bool_t       IsRunning()    const { return (fThread != NULL); }
+
+  static void* WriterThread( void* arg );
+
+protected:
+  TTree*         fTree;      // Output tree, filled by the writer thread
+  TTree*         fTemplate;  // Empty in-memory clone of fTree (caller's addresses)
+  TTree*         fChunkTree; // In-memory tree being filled by the caller
+  TTree**        fQueue;     // [fDepth] Ring of full chunks
+  UInt_t         fDepth;     // Maximum number of chunks waiting to be written
+  UInt_t         fChunk;     // Number of events per chunk
+  UInt_t         fHead;      // Index of oldest chunk not yet written
+  UInt_t         fNQueued;   // Number of chunks not yet written
+  Bool_t         fStop;      // Request for the writer thread to exit
+
+  TThread*       fThread;    // Writer thread
+  TMutex*        fMutex;     // Protects the queue
+  TMutex*        fFileMutex; // Serializes writing to the output file
+  TCondition*    fWorkCond;  // Signals a new chunk for the writer
+  TCondition*    fFreeCond;  // Signals a written chunk to the caller
+
+  void           Flush();
+  TTree*         NewChunk();
+  void           WriteLoop();
+
+private:
+  THaTreeWriter( const THaTreeWriter& );
+  THaTreeWriter& operator=( const THaTreeWriter& );
+
+  ClassDef(THaTreeWriter,0)  // Background writer thread for an output tree
+};
+
+#endif
@@ -130,6 +130,9 @@ public:
 
   Double_t        GetValue( Int_t i = 0 )  const { return GetValueAsDouble(i); }
   const void*     GetValuePointer()        const { return fValueP; }
+  const void*     GetDataPointer()         const;
+  Int_t           GetValues( Double_t* buf, Int_t n, Int_t first = 0 ) const;
+  Int_t           GetValues( Float_t* buf, Int_t n, Int_t first = 0 ) const;
 
   virtual ULong_t Hash() const { return fArrayData.Hash(); }
   virtual Bool_t  HasSameSize( const THaVar& rhs ) const;
@@ -256,6 +259,24 @@ const Int_t* THaVar::GetDim() const
   return fArrayData.GetDim();
 }
 
+//_____________________________________________________________________________
+inline
+const void* THaVar::GetDataPointer() const
+{
+  // Pointer to the first element of the data if they are contiguous
+  // in memory (scalars, fixed and variable-size arrays of basic types),
+  // NULL otherwise (arrays of pointers, data in objects).
+  // The element type is GetType(), or GetType()-kDoubleP for kDoubleP...
+
+  if( !IsBasic() || fValueP == NULL )
+    return NULL;
+  if( fType >= kDouble && fType <= kByte )
+    return fValueP;
+  if( fType >= kDoubleP && fType <= kByteP )
+    return *fValueDD;
+  return NULL;
+}
+
 //_____________________________________________________________________________
 inline
 Double_t THaVar::GetValueAsDouble( Int_t i ) const
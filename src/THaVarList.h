@@ -8,17 +8,22 @@
 //
 //////////////////////////////////////////////////////////////////////////
 
-#include "TList.h"
+#include "THashList.h"
 #include "THaVar.h"
 #include "VarDef.h"
+#include <vector>
+#include <map>
+#include <string>
 
 class THaRTTI;
+class TVirtualMutex;
 
-class THaVarList : public TList {
+class THaVarList : public THashList {
   
 public:
-  THaVarList() : TList() {}
-  virtual ~THaVarList() { Clear(); }
+  THaVarList() : THashList(TCollection::kInitHashTableCapacity,2),
+    fMutex(NULL) {}
+  virtual ~THaVarList();
 
   // Define() with reference to variable
   THaVar*  Define( const char* name, const char* descript, 
@@ -147,6 +152,8 @@ public:
 		   const Int_t* count=NULL )
     { return Define( name, name, var, count ); }
 
+  virtual void     AddFirst( TObject* obj );
+  virtual void     AddLast( TObject* obj );
   virtual void     Clear( Option_t* opt="" );
   virtual THaVar*  DefineByType( const char* name, const char* desc,
 				 const void* loc, VarType type, 
@@ -156,21 +163,49 @@ public:
 				 TClass* const cl, const char* errloc="" );
   virtual Int_t    DefineVariables( const VarDef* list, 
 				    const char* prefix="",
-				    const char* caller="" );
+				    const char* caller="",
+				    Int_t* handles=NULL );
   virtual Int_t    DefineVariables( const RVarDef* list, 
 				    const TObject* obj,
 				    const char* prefix="",
 				    const char* caller="",
-				    const char* var_prefix="" );
+				    const char* var_prefix="",
+				    Int_t* handles=NULL );
   virtual THaVar*  Find( const char* name ) const;
+  virtual Int_t    FindMatches( const char* expr, std::vector<THaVar*>& vars,
+				Bool_t wildcard = kTRUE ) const;
+          THaVar*  Get( Int_t handle ) const;
+          Int_t    GetHandle( const char* name ) const;
   virtual void     PrintFull(Option_t *opt="") const;
+  virtual TObject* Remove( TObject* obj );
   virtual Int_t    RemoveName( const char* name );
   virtual Int_t    RemoveRegexp( const char* expr, Bool_t wildcard = kTRUE );
 
 protected:
 
-  ClassDef(THaVarList,2)   //List of analyzer global variables
+  // Handles: index into fHandles, assigned once per variable name and
+  // kept for the lifetime of the list, even if the variable is removed
+  // and later defined again
+  std::vector<THaVar*>       fHandles;  //! Variable for each handle (or 0)
+  std::map<std::string,Int_t> fIndex;   //! Handles by name, sorted
+  mutable TVirtualMutex*      fMutex;   //! Serializes access from threads
+
+  Int_t  Register( THaVar* var );
+
+  ClassDef(THaVarList,3)   //List of analyzer global variables
 };
 
+//_____________________________________________________________________________
+inline
+THaVar* THaVarList::Get( Int_t handle ) const
+{
+  // Variable with the given handle (see GetHandle), or NULL if the
+  // variable is currently not defined
+
+  if( handle < 0 || handle >= static_cast<Int_t>(fHandles.size()) )
+    return NULL;
+  return fHandles[handle];
+}
+
 #endif
 
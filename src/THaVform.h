@@ -17,7 +17,9 @@
 using namespace std;
 
 class THaVar;
+class THaOutputWriter;
 class THaVarList;
+class THaExprGraph;
 class THaCut;
 class THaCutList;
 class THaVar;
@@ -48,6 +50,10 @@ public:
 // Must 'SetOutput' at initialization if output to appear in tree.
 // Normally not desired for THaVforms that belong to THaVhist's
   Int_t SetOutput(TTree *tree);
+// Same for an additional output format
+  Int_t SetOutput(THaOutputWriter *writer);
+// Tree whose branch address is updated if the array data grow
+  void SetOutputTree(TTree *tree);
 // Must 'Process' once per event before processing the things
 // that use this object.
   Int_t Process();
@@ -64,6 +70,9 @@ public:
   Int_t GetSize() const { return fObjSize; };
 // Get names of variable that are used by this formula.
   std::vector<string> GetVars() const; 
+// Evaluate the formulas and cuts of this object via a shared
+// expression graph. Returns the number of formulas added.
+  Int_t AddToGraph( THaExprGraph& graph );
   
 protected:
 
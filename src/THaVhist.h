@@ -16,6 +16,8 @@ class THaVar;
 class TH1F;
 class TH2F;
 class THaCut;
+class THaExprGraph;
+class THaTreeWriter;
 
 using std::string;
 
@@ -43,10 +45,18 @@ public:
    Int_t Init();
 // Must ReAttach() if pointers to global variables reset
    void ReAttach();
+// Evaluate the formulas owned by this histogram via a shared graph
+   Int_t AddToGraph( THaExprGraph& graph );
+// Background writer of the output file, if any. Histograms booked
+// while it runs are created under its file lock.
+   void  SetWriter( THaTreeWriter* writer ) { fWriter = writer; };
 // Must Process() each event. 
    Int_t Process();
 // Must End() to write histogram to output at end of analysis.
    Int_t End();
+// Fill the values buffered by Process() into the histograms. 
+// Done automatically when the buffers are full and by End().
+   void  Flush();
 // Self-explanatory printouts.
    void  Print() const;
    void  ErrPrint() const;
@@ -64,6 +74,9 @@ protected:
    Int_t FindVarSize();
    Bool_t FindEye(const string& var);
    Int_t GetCut(Int_t index=0); 
+   void  Buffer(Int_t ih, Double_t x);
+   void  Buffer(Int_t ih, Double_t x, Double_t y);
+   void  FlushHisto(Int_t ih);
 
    enum FEr { kOK = 0, kNoBinX, kIllFox, kIllFoy, kIllCut,
               kNoX, kAxiSiz, kCutSix, kCutSiy,
@@ -71,6 +84,7 @@ protected:
 
    static const int fgVERBOSE = 1;
    static const int fgVHIST_HUGE = 10000;
+   static const UInt_t fgBATCH_SIZE = 1024;  // Values buffered per histogram
 
    string fType, fName, fTitle, fVarX, fVarY, fScut;
    Int_t fNbinX, fNbinY, fSize, fInitStat, fScaler, fEye;
@@ -78,8 +92,11 @@ protected:
    Bool_t fFirst, fProc;
 
    std::vector<TH1* > fH1;
+   // Values of X and Y not yet filled into fH1, for each histogram
+   std::vector< std::vector<Double_t> > fBufX, fBufY;
    THaVform *fFormX, *fFormY, *fCut;
    Bool_t fMyFormX, fMyFormY, fMyCut;
+   THaTreeWriter* fWriter;
 
 private:
 
@@ -139,6 +156,21 @@ void THaVhist::SetCut(THaVform *cut)
   fMyCut = false;
 };
 
+inline
+void THaVhist::Buffer(Int_t ih, Double_t x)
+{
+  std::vector<Double_t>& bx = fBufX[ih];
+  bx.push_back(x);
+  if (bx.size() >= fgBATCH_SIZE) FlushHisto(ih);
+}
+
+inline
+void THaVhist::Buffer(Int_t ih, Double_t x, Double_t y)
+{
+  fBufY[ih].push_back(y);
+  Buffer(ih, x);
+}
+
 inline
 Int_t THaVhist::CheckCut(Int_t index) { 
   // Check the cut.  Returns !=0 if cut condition passed.